@@ -0,0 +1,241 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file LayoutBench.cpp
+ * @brief benchmarks of the layout managers from 10 to 10000 clients.
+ * @date 2026-10-19
+ * every benchmark reports the time, the allocations and the X requests
+ * per operation, X requests are counted by noopX11Wrapper.
+ */
+
+#include <benchmark/benchmark.h>
+#include "Layouts/TreeLayoutManager.hpp"
+#include "Layouts/MasterLayoutManager.hpp"
+#include "X11wrapper/noopX11Wrapper.hpp"
+#include "Client.hpp"
+#include "Logger.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <vector>
+
+static std::atomic<size_t> allocationCount(0);
+
+void *operator new(size_t size) {
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+	void *ptr = std::malloc(size ? size : 1);
+	if (ptr == nullptr)
+		throw std::bad_alloc();
+	return ptr;
+}
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+
+namespace {
+
+const int SCREEN_WIDTH = 1920;
+const int SCREEN_HEIGHT = 1080;
+
+/**
+ * @class LayoutFixture
+ * @brief clients shared by the layouts of one benchmark and the counters of the measured section
+ */
+class LayoutFixture {
+public:
+	explicit LayoutFixture(size_t count) : wrapper(std::make_shared<noopX11Wrapper>()) {
+		clients.reserve(count);
+		for (size_t i = 0; i < count; i++)
+			clients.push_back(std::make_shared<Client>(nullptr, 42, 1000 + i, nullptr, 0, 1, wrapper));
+	}
+	void start() {
+		allocations_ = allocationCount.load(std::memory_order_relaxed);
+		requests_ = wrapper->requests;
+	}
+	void stop() {
+		allocationTotal += allocationCount.load(std::memory_order_relaxed) - allocations_;
+		requestTotal += wrapper->requests - requests_;
+	}
+	void report(benchmark::State &state, size_t operations) const {
+		auto ops = static_cast<double>(operations);
+		state.counters["time/op"] = benchmark::Counter(ops, benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+		state.counters["allocs/op"] = static_cast<double>(allocationTotal) / ops;
+		state.counters["xreq/op"] = static_cast<double>(requestTotal) / ops;
+	}
+	std::shared_ptr<noopX11Wrapper>			wrapper;
+	std::vector<std::shared_ptr<Client>>	clients;
+	size_t									allocationTotal = 0;
+	size_t									requestTotal = 0;
+private:
+	size_t									allocations_ = 0;
+	size_t									requests_ = 0;
+};
+
+std::unique_ptr<TreeLayoutManager> makeTree() {
+	return std::unique_ptr<TreeLayoutManager>(
+			new TreeLayoutManager(nullptr, 42, SCREEN_WIDTH, SCREEN_HEIGHT, 0, 0, 1, 0, 30));
+}
+std::unique_ptr<MasterLayoutManager> makeMaster() {
+	return std::unique_ptr<MasterLayoutManager>(
+			new MasterLayoutManager(nullptr, 42, SCREEN_WIDTH, SCREEN_HEIGHT, 0, 0, 1, 0, 30, true));
+}
+template <typename Layout>
+void fill(Layout &layout, LayoutFixture &fixture) {
+	for (auto &client : fixture.clients)
+		layout.addClient(client);
+}
+
+/**
+ * @brief fill an empty layout with all the clients, one operation per client
+ */
+template <typename Layout, std::unique_ptr<Layout> (*Make)()>
+void BM_AddClient(benchmark::State &state) {
+	LayoutFixture fixture(state.range(0));
+	size_t operations = 0;
+	for (auto _ : state) {
+		state.PauseTiming();
+		auto layout = Make();
+		fixture.start();
+		state.ResumeTiming();
+		fill(*layout, fixture);
+		state.PauseTiming();
+		fixture.stop();
+		operations += fixture.clients.size();
+		layout.reset();
+		state.ResumeTiming();
+	}
+	fixture.report(state, operations);
+}
+
+/**
+ * @brief empty a full layout, the clients are removed in the order they were added
+ */
+template <typename Layout, std::unique_ptr<Layout> (*Make)()>
+void BM_RemoveClient(benchmark::State &state) {
+	LayoutFixture fixture(state.range(0));
+	size_t operations = 0;
+	for (auto _ : state) {
+		state.PauseTiming();
+		auto layout = Make();
+		fill(*layout, fixture);
+		fixture.start();
+		state.ResumeTiming();
+		for (auto &client : fixture.clients)
+			layout->removeClient(client.get());
+		state.PauseTiming();
+		fixture.stop();
+		operations += fixture.clients.size();
+		layout.reset();
+		state.ResumeTiming();
+	}
+	fixture.report(state, operations);
+}
+
+/**
+ * @brief grow then shrink the clients of a full layout in turn
+ */
+template <typename Layout, std::unique_ptr<Layout> (*Make)(), void (*Grow)(Layout &, Client *, int)>
+void BM_Grow(benchmark::State &state) {
+	LayoutFixture fixture(state.range(0));
+	auto layout = Make();
+	fill(*layout, fixture);
+	size_t operations = 0;
+	size_t next = 0;
+	fixture.start();
+	for (auto _ : state) {
+		Client *client = fixture.clients[next % fixture.clients.size()].get();
+		Grow(*layout, client, (operations & 1) ? -4 : 4);
+		next += operations & 1;
+		operations++;
+	}
+	fixture.stop();
+	fixture.report(state, operations);
+}
+void growTree(TreeLayoutManager &layout, Client *client, int inc) { layout.growSpace(client, inc); }
+void growMaster(MasterLayoutManager &layout, Client *, int inc) { layout.growMaster(inc); }
+
+/**
+ * @brief resize a full layout, alternating between two sizes so every call has work to do
+ */
+template <typename Layout, std::unique_ptr<Layout> (*Make)()>
+void BM_ReSize(benchmark::State &state) {
+	LayoutFixture fixture(state.range(0));
+	auto layout = Make();
+	fill(*layout, fixture);
+	size_t operations = 0;
+	fixture.start();
+	for (auto _ : state) {
+		unsigned int shrink = (operations & 1) ? 0 : 40;
+		layout->reSize(Point(SCREEN_WIDTH - shrink, SCREEN_HEIGHT - shrink), Point(0, shrink));
+		operations++;
+	}
+	fixture.stop();
+	fixture.report(state, operations);
+}
+
+/**
+ * @brief same as BM_ReSize through updateGeometry, as done when the bars reserve space
+ */
+template <typename Layout, std::unique_ptr<Layout> (*Make)()>
+void BM_UpdateGeometry(benchmark::State &state) {
+	LayoutFixture fixture(state.range(0));
+	auto layout = Make();
+	fill(*layout, fixture);
+	size_t operations = 0;
+	fixture.start();
+	for (auto _ : state) {
+		unsigned int shrink = (operations & 1) ? 0 : 40;
+		layout->updateGeometry(SCREEN_WIDTH - shrink, SCREEN_HEIGHT - shrink, 0, shrink);
+		operations++;
+	}
+	fixture.stop();
+	fixture.report(state, operations);
+}
+
+} // namespace
+
+#define LAYOUT_BENCH(name, ...) \
+	BENCHMARK_TEMPLATE(name, __VA_ARGS__)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMicrosecond)
+
+LAYOUT_BENCH(BM_AddClient, TreeLayoutManager, makeTree);
+LAYOUT_BENCH(BM_RemoveClient, TreeLayoutManager, makeTree);
+LAYOUT_BENCH(BM_Grow, TreeLayoutManager, makeTree, growTree);
+LAYOUT_BENCH(BM_ReSize, TreeLayoutManager, makeTree);
+LAYOUT_BENCH(BM_UpdateGeometry, TreeLayoutManager, makeTree);
+LAYOUT_BENCH(BM_AddClient, MasterLayoutManager, makeMaster);
+LAYOUT_BENCH(BM_RemoveClient, MasterLayoutManager, makeMaster);
+LAYOUT_BENCH(BM_Grow, MasterLayoutManager, makeMaster, growMaster);
+LAYOUT_BENCH(BM_ReSize, MasterLayoutManager, makeMaster);
+LAYOUT_BENCH(BM_UpdateGeometry, MasterLayoutManager, makeMaster);
+
+int main(int argc, char **argv) {
+	std::ostream discard(nullptr);
+	Logger::Create(discard, L_ERROR);
+	benchmark::Initialize(&argc, argv);
+	if (benchmark::ReportUnrecognizedArguments(argc, argv))
+		return 1;
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+	Logger::Destroy();
+	return 0;
+}
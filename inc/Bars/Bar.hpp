@@ -37,6 +37,18 @@ class ConfigDataWidget;
 class Widget;
 class TSBarsData;
 
+/**
+ * @struct BarWidget
+ * @brief a widget slot of a bar, keep what is needed to re-create the widget
+ * widget is nullptr while its plugin is unloaded
+ */
+struct BarWidget {
+	Widget								*widget;
+	Window								window;
+	void								*handle;
+	std::shared_ptr<ConfigDataWidget>	config;
+};
+
 class Bar
 {
 public:
@@ -47,12 +59,29 @@ public:
 	Window			getWindow() const;
 	unsigned int	getSizeX() const;
 	unsigned int	getSizeY() const;
-	void addWidget(void *handle, std::shared_ptr<ConfigDataWidget>);
-	const std::unordered_map<Window, Widget *> &getWidgets() const;
+/**
+ * @fn Widget *Bar::addWidget(void *handle, std::shared_ptr<ConfigDataWidget> widgetConfig)
+ * @brief add a widget slot to the bar and create the widget from the plugin handle
+ * @return the new widget, nullptr if the plugin could not create it
+ */
+	Widget *addWidget(void *handle, std::shared_ptr<ConfigDataWidget> widgetConfig);
+/**
+ * @fn Widget *Bar::createWidget(size_t index, void *handle)
+ * @brief create the widget of an empty slot with the same geometry and configuration
+ * @return the new widget, nullptr if the plugin could not create it
+ */
+	Widget *createWidget(size_t index, void *handle);
+/**
+ * @fn void Bar::destroyWidget(size_t index)
+ * @brief destroy the widget of a slot with the destroyPlugin of its library and its window
+ * the slot is kept so the widget can be re-created after a plugin reload
+ */
+	void destroyWidget(size_t index);
+	const std::vector<BarWidget> &getWidgets() const;
 
 private:
 	std::shared_ptr<ConfigDataBar> configData;
-	std::unordered_map<Window, Widget *> widgets;
+	std::vector<BarWidget> widgets;
 	std::shared_ptr<TSBarsData> tsData;
 	Display *display;
 	Window window;
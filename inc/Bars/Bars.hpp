@@ -31,6 +31,10 @@
 #include <string>
 #include <thread>
 #include <set>
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include "Bars/BarsDataValue.hpp"
 
 extern "C" {
 #include <X11/Xlib.h>
@@ -38,8 +42,10 @@ extern "C" {
 
 class Bar;
 class ConfigDataBars;
+class ConfigDataBar;
 class TSBarsData;
 class Widget;
+class SystemSampler;
 
 /**
  * @class Bars
@@ -121,7 +127,11 @@ public:
  * used to calculate the space left for the Layout Manager.
  */
 	[[nodiscard]] unsigned int getSpaceW() const;
-	const std::unordered_map<std::string, std::string> &getData() const;
+/**
+ * @fn const std::vector<BarsDataValue> &Bars::getData() const
+ * @brief last value collected for each channel, indexed by channel id
+ */
+	const std::vector<BarsDataValue> &getData() const;
 /**
  * @fn bool Bars::isBarWindow(Window window)
  * @brief Check if the window is a bar window
@@ -132,7 +142,7 @@ public:
 	bool isBarWindow(Window window);
 /**
  * @fn void Bars::stop_thread()
- * @brief Stop the thread (join)
+ * @brief Stop the threads (join), the bars thread and the system sampler
  */
 	void stop_thread();
 /**
@@ -143,16 +153,56 @@ public:
 	void redraw();
 	void addPluginLocation(const std::string& location);
 	[[nodiscard]] const std::set<std::string>& getPluginsLocations() const;
-	[[nodiscard]] void * getWidgetTypeHandle(const std::string& widgetType);
-	void setWidgetTypeHandle(const std::string& widgetType, void * handle);
+/**
+ * @fn void *Bars::getPluginHandle(const std::string& location)
+ * @brief handle of the library loaded from location, nullptr if it is not loaded
+ */
+	[[nodiscard]] void * getPluginHandle(const std::string& location);
+/**
+ * @fn void Bars::requestReload()
+ * @brief ask the Bars thread to reload the widget plugins modified on disk
+ * can be called from any thread, the reload is done by the Bars thread
+ * @see Bars::reloadPlugins
+ */
+	void requestReload();
+/**
+ * @fn void Bars::reloadPlugins()
+ * @brief reload the plugins whose file changed since they were loaded
+ * the widgets of a changed plugin are destroyed, the library is closed and
+ * opened again and the widgets are re-created in the same bar slot, with the
+ * last data of their channels. Unchanged plugins are left alone.
+ * @note must be called from the Bars thread
+ */
+	void reloadPlugins();
+/**
+ * @fn bool Bars::reconfigure(std::shared_ptr<ConfigDataBars> config, const std::vector<size_t> &changed)
+ * @brief ask the Bars thread to rebuild the bars whose definition changed
+ * can be called from any thread, the space reserved by the bars is updated
+ * at once, the windows and widgets of the changed bars are re-created by the
+ * Bars thread, the other bars are left alone.
+ * @param config the reloaded bars configuration
+ * @param changed indexes of the bars added, removed or modified
+ * @return true if the space reserved by the bars changed
+ */
+	bool reconfigure(std::shared_ptr<ConfigDataBars> config, const std::vector<size_t> &changed);
+/**
+ * @fn void Bars::subscribeWidget(Widget *w)
+ * @brief resolve the data keys of the widget to channel ids and subscribe it
+ */
 	void subscribeWidget(Widget *w);
+/**
+ * @fn void Bars::unsubscribeWidget(Widget *w)
+ * @brief remove the widget from every channel it subscribed to
+ */
+	void unsubscribeWidget(Widget *w);
 private:
 	static Bars*									instance;
 	std::vector<std::unique_ptr<Bar>>				bars;
 	std::vector<Window>								windows;
 	std::shared_ptr<ConfigDataBars>					configData;
 	std::shared_ptr<TSBarsData>						tsData;
-	std::unordered_map<std::string, std::string>	data;
+	std::vector<BarsDataValue>						data;
+	std::vector<BarsChannel>						updatedChannels;
 	Display*										display;
 	Window											root;
 	unsigned int									spaceN;
@@ -160,9 +210,38 @@ private:
 	unsigned int									spaceE;
 	unsigned int									spaceW;
 	std::thread										barThread;
+	std::unique_ptr<SystemSampler>					sampler;
 	std::set<std::string>pluginsLocations;
-	std::unordered_map<std::string, void *> widgetTypeHandle;
-	std::unordered_map<std::string,std::vector<Widget *>> subscriptions;
+	std::unordered_map<std::string, void *> pluginHandles;
+	std::unordered_map<std::string, std::pair<long long, unsigned long>> pluginStamps;
+	std::atomic<bool> reloadRequested;
+	std::atomic<bool> rebuildRequested;
+	std::mutex rebuildMutex;
+	std::shared_ptr<ConfigDataBars> pendingConfig;
+	std::vector<size_t> pendingRebuild;
+	std::mutex windowsMutex;
+	std::vector<std::vector<std::pair<Widget *, size_t>>> subscriptions;
 	Bars();
+/**
+ * @fn void *Bars::loadPlugin(const std::string& location)
+ * @brief dlopen the library and record its modification time and inode
+ */
+	void *loadPlugin(const std::string& location);
+/**
+ * @fn std::unique_ptr<Bar> Bars::createBar(const std::shared_ptr<ConfigDataBar> &bar)
+ * @brief create the window and the widgets of a bar, load its plugins if needed
+ */
+	std::unique_ptr<Bar> createBar(const std::shared_ptr<ConfigDataBar> &bar);
+/**
+ * @fn bool Bars::computeSpaces(const std::shared_ptr<ConfigDataBars> &config)
+ * @brief compute the space reserved on each side of the screen, true if it changed
+ */
+	bool computeSpaces(const std::shared_ptr<ConfigDataBars> &config);
+/**
+ * @fn void Bars::rebuildBars()
+ * @brief re-create the bars queued by reconfigure
+ * @note must be called from the Bars thread
+ */
+	void rebuildBars();
 };
 #endif // BARS_HPP
\ No newline at end of file
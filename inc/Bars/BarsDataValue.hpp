@@ -0,0 +1,82 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file BarsDataValue.hpp
+ * @brief Typed values exchanged between the Window Manager and the widgets.
+ * @date 2026-10-19
+ */
+#ifndef BARSDATAVALUE_HPP
+#define BARSDATAVALUE_HPP
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * @enum BarsDataType
+ * @brief type of the value currently held by a channel
+ */
+enum BarsDataType {
+	BD_NONE,
+	BD_INT,
+	BD_STRING_LIST,
+	BD_STRUCT
+};
+/**
+ * @brief channel identifier, resolved once from the channel name
+ * @see TSBarsData::getChannel
+ */
+using BarsChannel = unsigned int;
+/**
+ * @brief maximum size of a struct published on a channel
+ */
+constexpr size_t BARS_STRUCT_SIZE = 64;
+/**
+ * @struct BarsDataValue
+ * @brief value of a data channel
+ * Only the member matching type is meaningful.
+ * Small trivially copyable structs are stored inline so publishing them
+ * does not allocate.
+ */
+struct BarsDataValue {
+	BarsDataType				type = BD_NONE;
+	long						integer = 0;
+	std::vector<std::string>	list;
+	unsigned char				blob[BARS_STRUCT_SIZE] = {};
+	size_t						blobSize = 0;
+/**
+ * @fn template <typename T> T BarsDataValue::asStruct() const
+ * @brief copy the stored struct out of the value
+ * @tparam T must be the type that was published on the channel
+ */
+	template <typename T>
+	T asStruct() const {
+		static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+		static_assert(sizeof(T) <= BARS_STRUCT_SIZE, "T is too big for a bar channel");
+		T result{};
+		if (type == BD_STRUCT && blobSize == sizeof(T))
+			std::memcpy(&result, blob, sizeof(T));
+		return result;
+	}
+};
+#endif // BARSDATAVALUE_HPP
@@ -0,0 +1,121 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file SystemSampler.hpp
+ * @brief SystemSampler class header.
+ * @date 2026-10-19
+ */
+#ifndef SYSTEMSAMPLER_HPP
+#define SYSTEMSAMPLER_HPP
+#include <memory>
+#include <thread>
+#include <functional>
+#include <chrono>
+#include "Bars/BarsDataValue.hpp"
+
+class TSBarsData;
+
+/**
+ * @class SystemSampler
+ * @brief Sample system statistics for the system widgets
+ * The sampler runs in its own thread, owned by Bars. The files it reads
+ * are opened once and re-read with pread into a fixed buffer, values are
+ * parsed in place so a tick does not allocate.
+ * Values are published at the precision they are displayed, TSBarsData
+ * only wakes the Bars thread when one of them changes.
+ * Channels :
+ * - CpuUsage : percentage of cpu time spent outside idle/iowait
+ * - MemUsage : percentage of memory used (MemTotal - MemAvailable)
+ * - LoadAvg : 1 minute load average * 100
+ * - NetRx / NetTx : KiB/s received / sent, loopback excluded
+ * - Battery : capacity of BAT0 in percent
+ * @see Bars
+ * @see TSBarsData
+ */
+class SystemSampler
+{
+public:
+	SystemSampler();
+	~SystemSampler();
+	SystemSampler(const SystemSampler&) = delete;
+	SystemSampler& operator=(const SystemSampler&) = delete;
+/**
+ * @fn bool SystemSampler::init(std::shared_ptr<TSBarsData> tsData, const std::function<bool(BarsChannel)> &isSubscribed)
+ * @brief resolve the channels and open the files of the subscribed ones
+ * @param isSubscribed return true if a widget subscribed to the channel
+ * @return true if at least one source has to be sampled
+ */
+	bool init(std::shared_ptr<TSBarsData> tsData, const std::function<bool(BarsChannel)> &isSubscribed);
+/**
+ * @fn void SystemSampler::start_thread()
+ * @brief start the sampling thread if a source is enabled
+ */
+	void start_thread();
+/**
+ * @fn void SystemSampler::stop_thread()
+ * @brief join the sampling thread, it stops with the Window Manager
+ */
+	void stop_thread();
+/**
+ * @fn void SystemSampler::sample()
+ * @brief read every enabled source once and publish the values
+ */
+	void sample();
+private:
+	enum Source {
+		S_CPU,
+		S_MEM,
+		S_LOAD,
+		S_NET,
+		S_BATTERY,
+		S_COUNT
+	};
+	void run();
+/**
+ * @fn ssize_t SystemSampler::readSource(Source source)
+ * @brief pread the whole file into buffer, null terminated
+ * @return number of bytes read, -1 on error
+ */
+	ssize_t readSource(Source source);
+	void sampleCpu();
+	void sampleMem();
+	void sampleLoad();
+	void sampleNet();
+	void sampleBattery();
+	std::shared_ptr<TSBarsData>						tsData;
+	std::thread										samplerThread;
+	int												fds[S_COUNT];
+	char											buffer[8192];
+	BarsChannel										cpuChannel;
+	BarsChannel										memChannel;
+	BarsChannel										loadChannel;
+	BarsChannel										rxChannel;
+	BarsChannel										txChannel;
+	BarsChannel										batteryChannel;
+	unsigned long long								cpuTotal;
+	unsigned long long								cpuIdle;
+	unsigned long long								rxBytes;
+	unsigned long long								txBytes;
+	std::chrono::steady_clock::time_point			lastNetSample;
+	bool											netPrimed;
+};
+#endif // SYSTEMSAMPLER_HPP
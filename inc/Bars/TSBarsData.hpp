@@ -27,22 +27,86 @@
 #include <condition_variable>
 #include <unordered_map>
 #include <string>
-#include <set>
+#include <vector>
+#include "Bars/BarsDataValue.hpp"
+/**
+ * @class TSBarsData
+ * @brief Thread safe store for the data published to the widgets
+ * Data is organised in typed channels. A channel is created the first
+ * time its name is resolved with getChannel, after that it is only
+ * referenced by its integer id.
+ * The main thread publishes, the Bars thread collects the modified
+ * channels. Publishing an integer or a struct never allocates.
+ * @see Bars
+ */
 class TSBarsData
 {
 public:
 	TSBarsData();
 	~TSBarsData();
-	void addData(std::string key, std::string value);
-	std::unordered_map<std::string,std::string> getData();
-	void removeData(std::string key);
-	void modifyData(std::string key, std::string value);
+/**
+ * @fn BarsChannel TSBarsData::getChannel(const std::string &name)
+ * @brief resolve a channel name to its id, create the channel if needed
+ * should only be called at initialisation (WM init, plugin load)
+ */
+	BarsChannel getChannel(const std::string &name);
+/**
+ * @fn void TSBarsData::publishInt(BarsChannel channel, long value)
+ * @brief publish an integer, the Bars thread is only woken if the value changed
+ */
+	void publishInt(BarsChannel channel, long value);
+/**
+ * @fn void TSBarsData::publishStringList(BarsChannel channel, const std::vector<std::string> &value)
+ * @brief publish a list of strings
+ */
+	void publishStringList(BarsChannel channel, const std::vector<std::string> &value);
+/**
+ * @fn template <typename T> void TSBarsData::publishStruct(BarsChannel channel, const T &value)
+ * @brief publish a small trivially copyable struct, it is stored inline in the channel
+ */
+	template <typename T>
+	void publishStruct(BarsChannel channel, const T &value) {
+		static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+		static_assert(sizeof(T) <= BARS_STRUCT_SIZE, "T is too big for a bar channel");
+		std::lock_guard<std::mutex> lock(mutex);
+		BarsDataValue &v = channels.at(channel);
+		if (v.type == BD_STRUCT && v.blobSize == sizeof(T) && std::memcmp(v.blob, &value, sizeof(T)) == 0)
+			return;
+		v.type = BD_STRUCT;
+		v.blobSize = sizeof(T);
+		std::memcpy(v.blob, &value, sizeof(T));
+		markDirty(channel);
+	}
+/**
+ * @fn void TSBarsData::collect(std::vector<BarsDataValue> &snapshot, std::vector<BarsChannel> &updated)
+ * @brief copy the channels modified since the last call into snapshot
+ * @param snapshot copy of the channels owned by the reader, indexed by channel id
+ * @param updated filled with the ids of the modified channels
+ */
+	void collect(std::vector<BarsDataValue> &snapshot, std::vector<BarsChannel> &updated);
+/**
+ * @fn void TSBarsData::notify()
+ * @brief wake the Bars thread without modifying any channel
+ */
+	void notify();
+/**
+ * @fn bool TSBarsData::wait()
+ * @brief wait for modified data or a notification, timeout after 1 second
+ * @return false on timeout
+ */
 	bool wait();
 	bool dataChanged = false;
 private:
+/**
+ * @fn void TSBarsData::markDirty(BarsChannel channel)
+ * @brief flag the channel as modified and wake the Bars thread, mutex must be held
+ */
+	void markDirty(BarsChannel channel);
 	std::mutex										mutex;
 	std::condition_variable							cv;
-	std::unordered_map<std::string, std::string>	data;
-	std::set<std::string>							modifiedKeys;
+	std::unordered_map<std::string, BarsChannel>	names;
+	std::vector<BarsDataValue>						channels;
+	std::vector<bool>								dirtyFlags;
+	std::vector<BarsChannel>						dirty;
 };
-#endif // TSBARSDATA_HPP
\ No newline at end of file
+#endif // TSBARSDATA_HPP
@@ -28,6 +28,7 @@ extern "C" {
 };
 #include <string>
 #include <vector>
+#include "Bars/BarsDataValue.hpp"
 
 class Widget
 {
@@ -50,9 +51,20 @@ public:
 	virtual void shutdown() = 0;
 	virtual void setPosition(int x, int y) = 0;
 	virtual void setSize(int width, int height) = 0;
+/**
+ * @fn virtual std::vector<std::string> Widget::registerDataKey()
+ * @brief names of the data channels the widget subscribes to
+ * names are resolved to channel ids once, when the widget is loaded
+ */
 	virtual std::vector<std::string> registerDataKey() = 0;
 	virtual void unregisterDataKey(const std::string& key) = 0;
-	virtual void updateData(const std::string& key, const std::string& value) = 0;
+/**
+ * @fn virtual void Widget::updateData(size_t index, const BarsDataValue& value)
+ * @brief called from the Bars thread when a subscribed channel is modified
+ * @param index position of the channel in the list returned by registerDataKey
+ * @param value new value of the channel
+ */
+	virtual void updateData(size_t index, const BarsDataValue& value) = 0;
 };
 //Widget::~Widget() {}
 #endif // WIDGET_HPP
\ No newline at end of file
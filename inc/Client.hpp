@@ -130,6 +130,45 @@ public:
  * @return std::string
  */
 	const std::string &getTitle() const;
+/**
+ * @fn bool Client::updateTitle(Atom property)
+ * @brief read the title again after a change of property, _NET_WM_NAME is preferred to WM_NAME
+ * @param property the changed property, other properties are ignored
+ * @return true if the title changed
+ */
+	bool updateTitle(Atom property);
+/**
+ * @fn void Client::updateProtocols()
+ * @brief read WM_PROTOCOLS to know if the client supports WM_DELETE_WINDOW and _NET_WM_PING
+ */
+	void updateProtocols();
+/**
+ * @fn void Client::close()
+ * @brief ask the client to close with WM_DELETE_WINDOW, or kill its connection if it does not support it
+ * only requests are sent, the Window Manager never waits for the client
+ */
+	void close();
+/**
+ * @fn bool Client::pingTick(Time timestamp)
+ * @brief called on each ping period, send a _NET_WM_PING or mark the client hung
+ * a client that did not answer the ping of the previous period is hung
+ * @return true if the client just became hung
+ */
+	bool pingTick(Time timestamp);
+/**
+ * @fn bool Client::pong(Time timestamp)
+ * @brief the client answered a ping, only the answer to the pending ping is accepted
+ * @return true if the client was hung
+ */
+	bool pong(Time timestamp);
+	[[nodiscard]] bool isHung() const;
+/**
+ * @fn void Client::setFullscreen(bool fullscreen)
+ * @brief mark the client fullscreen, its layout stops moving it until it leaves fullscreen
+ */
+	void setFullscreen(bool fullscreen);
+	[[nodiscard]] bool isFullscreen() const;
+	[[nodiscard]] bool supportsPing() const;
 /**
  * @fn const std::string &Client::getClass() const
  * @brief Client::getClass() return the class of the client, the class is get during the construction of the client
@@ -147,8 +186,41 @@ public:
  * @brief Client::restack() restack the client window to avoid the frame to get in front of the client
  */
 	void restack();
+/**
+ * @fn unsigned long Client::getStackOrder() const
+ * @brief order of the last restack of the client, a higher value is above
+ */
+	unsigned long getStackOrder() const;
+/**
+ * @fn static bool Client::takeRestacked()
+ * @brief tell if a client was restacked since the previous call
+ */
+	static bool takeRestacked();
+/**
+ * @fn void Client::selectFrameInput()
+ * @brief select the events of the frame, EnterNotify is only selected when the focus follows the mouse
+ */
+	void selectFrameInput();
+/**
+ * @fn static void Client::setFollowMouse(bool followMouse)
+ * @brief select EnterNotify on the frames created from now on
+ */
+	static void setFollowMouse(bool followMouse);
+/**
+ * @fn static void Client::setProtocolAtoms(Atom protocols, Atom deleteWindow, Atom ping)
+ * @brief hand the atoms interned once by the WindowManager to the clients
+ */
+	static void setProtocolAtoms(Atom protocols, Atom deleteWindow, Atom ping);
+/**
+ * @fn void Client::setVisible(bool visible)
+ * @brief Client::setVisible() map or unmap the frame of the client, used by layouts that hide clients
+ * @param visible
+ */
+	void setVisible(bool visible);
 	void setGroup(std::shared_ptr<Group> g);
 private:
+	bool readTextProperty(Atom property, Atom type, std::string &value);
+	void sendProtocol(Atom protocol, Time timestamp);
 	Display *display_;
 	Window root_;
 	Window window_;
@@ -159,6 +231,19 @@ private:
 	bool mapped{};
 	std::string title_;
 	std::string class_;
+	unsigned long stackOrder_{};
+	bool deleteWindow_{};
+	bool ping_{};
+	bool pingPending_{};
+	Time pingTimestamp_{};
+	bool hung_{};
+	bool fullscreen_{};
+	static unsigned long stackCounter_;
+	static bool restacked_;
+	static bool followMouse_;
+	static Atom wmProtocols_;
+	static Atom wmDeleteWindow_;
+	static Atom netWmPing_;
 	std::weak_ptr<Group> group_;
 	std::shared_ptr<BaseX11Wrapper> wrapper;
 };
@@ -27,6 +27,21 @@
 #ifndef YGGDRASILWM_COMMANDBASE_HPP
 #define YGGDRASILWM_COMMANDBASE_HPP
 #include <string>
+extern "C" {
+#include <X11/Xlib.h>
+}
+class Client;
+
+/**
+ * @struct CommandContext
+ * @brief what triggered a command
+ * the arguments of the binding are not part of the context, they are
+ * parsed once by CommandBase::prepare when the binding is loaded.
+ */
+struct CommandContext {
+	const XKeyEvent	*event = nullptr;
+	Client			*target = nullptr;
+};
 
 /**
  * @class CommandBase
@@ -37,11 +52,18 @@ public:
 	CommandBase() = default;
 	virtual ~CommandBase() = default;
 /**
- * @fn virtual void CommandBase::execute(const std::string &args)
+ * @fn virtual void CommandBase::execute(const CommandContext &context)
  * @brief Each child class must implement this interface
- * @param args arguments to the command
+ * @param context the key event and the client it targets, both may be null
+ */
+	virtual void execute(const CommandContext &context) = 0;
+/**
+ * @fn virtual void CommandBase::prepare(const std::string &args)
+ * @brief called once when the binding is loaded, commands can parse their arguments here
+ * instead of doing it on every execution
+ * @param args arguments of the binding
  */
-	virtual void execute(const std::string &args) = 0;
+	virtual void prepare(const std::string &args) {}
 };
 
 #endif //YGGDRASILWM_COMMANDBASE_HPP
\ No newline at end of file
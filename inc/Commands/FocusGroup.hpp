@@ -36,10 +36,17 @@ public:
 			FocusGroup();
 			~FocusGroup() override = default;
 /**
- * @fn void FocusGroup::execute(const std::string &args)
- * @brief switch from the current active group to the group index passed as argument
+ * @fn void FocusGroup::prepare(const std::string &args)
+ * @brief parse the group number, starting at 1
  * @param args the string will be parsed to an integer to switch to the group index
  */
-	void	execute(const std::string &args) override;
+	void	prepare(const std::string &args) override;
+/**
+ * @fn void FocusGroup::execute(const CommandContext &context)
+ * @brief switch from the current active group to the group prepared from the arguments
+ */
+	void	execute(const CommandContext &context) override;
+private:
+	long	index_;
 };
 #endif //YGGDRASILWM_FOCUSGROUP_HPP
\ No newline at end of file
@@ -0,0 +1,52 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file FocusNext.hpp
+ * @brief FocusNext class header.
+ * @date 2026-10-19
+ */
+#ifndef YGGDRASILWM_FOCUSNEXT_HPP
+#define YGGDRASILWM_FOCUSNEXT_HPP
+#include "Commands/CommandBase.hpp"
+/**
+ * @class FocusNext
+ * @brief FocusNext give the focus to the next or previous client of the active group
+ */
+class FocusNext : public CommandBase {
+public:
+			FocusNext();
+			~FocusNext() override = default;
+/**
+ * @fn void FocusNext::prepare(const std::string &args)
+ * @brief parse the step
+ * @param args the string will be parsed to an integer, 1 for the next client, -1 for the previous one
+ */
+	void	prepare(const std::string &args) override;
+/**
+ * @fn void FocusNext::execute(const CommandContext &context)
+ * @brief focus the client step positions after the focused one, in a Max layout it becomes the visible client
+ */
+	void	execute(const CommandContext &context) override;
+private:
+	int		step_;
+};
+#endif //YGGDRASILWM_FOCUSNEXT_HPP
@@ -27,31 +27,28 @@
 #ifndef YGGDRASILWM_GROW_HPP
 #define YGGDRASILWM_GROW_HPP
 #include "Commands/CommandBase.hpp"
-extern "C" {
-#include <X11/Xlib.h>
-}
 /**
  * @class Grow
  * @brief Grow a window
  */
-struct DeserializedXKeyEvent {
-	int inc;
-	Window subwindow;
-	Window window;
-	unsigned int state;
-	unsigned int keycode;
-};
-
 class Grow : public CommandBase {
 public:
 	Grow();
 	~Grow() override = default;
 /**
- * @fn void FocusGroup::execute(const std::string &args)
- * @brief switch from the current active group to the group index passed as argument
- * @param args the string will be parsed to an integer to switch to the group index
+ * @fn void Grow::prepare(const std::string &args)
+ * @brief parse the number of pixels to grow, negative to shrink
+ */
+	void	prepare(const std::string &args) override;
+/**
+ * @fn void Grow::execute(const CommandContext &context)
+ * @brief grow the target client in the layout of its group
+ * in the master layouts the master column is grown instead, without a target
+ * the layout of the active group is used
  */
-	void	execute(const std::string &args) override;
-	static DeserializedXKeyEvent deserializeXKeyEvent(const std::string &serializedEvent);
+	void	execute(const CommandContext &context) override;
+	int		getInc() const;
+private:
+	int		inc_;
 };
-#endif //YGGDRASILWM_GROW_HPP
\ No newline at end of file
+#endif //YGGDRASILWM_GROW_HPP
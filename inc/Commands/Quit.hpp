@@ -36,6 +36,6 @@ class Quit : public CommandBase {
 public:
 			Quit();
 			~Quit() override = default;
-	void	execute(const std::string &args) override;
+	void	execute(const CommandContext &context) override;
 };
 #endif //YGGDRASILWM_QUIT_HPP
\ No newline at end of file
@@ -27,23 +27,51 @@
 #ifndef YGGDRASILWM_SPAWN_HPP
 #define YGGDRASILWM_SPAWN_HPP
 #include "Commands/CommandBase.hpp"
+#include <sys/types.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
 /**
  * @class Spawn
  * @brief Implement the mecanism to spawn a program
+ * the arguments are split once when the binding is loaded, the program is
+ * launched with posix_spawnp which does not copy the Window Manager memory.
+ * The children are reaped from the main loop when SIGCHLD is received on
+ * the signalfd returned by openChildSignalFd.
  */
 class Spawn : public CommandBase {
 public:
 			Spawn();
 			~Spawn() override = default;
 /**
- * @fn void Spawn::execute(const std::string &args)
- * @brief Spawn a program using the command arguments
- * Double fork to avoid zombie processes
- * Parse the command arguments to get the program name and its arguments
- * use of execvp to execute the command so it will search the bin using PATH
- * throw an exception if the command fails
- * @param args the first word separated by a space is the binary name, the rest is the arguments
+ * @fn void Spawn::prepare(const std::string &args)
+ * @brief split the arguments, words are separated by spaces, quotes keep spaces in a word
+ * @param args the first word is the binary name, the rest is the arguments
  */
-	void	execute(const std::string &args) override;
+	void	prepare(const std::string &args) override;
+/**
+ * @fn void Spawn::execute(const CommandContext &context)
+ * @brief Spawn the program prepared from the binding arguments
+ * use of posix_spawnp so it will search the bin using PATH, the child gets its own session
+ * and a clean signal mask. Launch failures are logged, nothing is thrown.
+ */
+	void	execute(const CommandContext &context) override;
+	const std::vector<std::string> &getArgv() const;
+/**
+ * @fn static int Spawn::openChildSignalFd()
+ * @brief block SIGCHLD and return a signalfd to receive it, must be called before other threads are started
+ * @return the file descriptor or -1 on error
+ */
+	static int	openChildSignalFd();
+/**
+ * @fn static void Spawn::reapChildren(int fd)
+ * @brief drain the signalfd and reap every exited child without blocking
+ */
+	static void	reapChildren(int fd);
+	static size_t	getChildCount();
+private:
+	std::vector<std::string>						argv_;
+	std::vector<char *>								argvPtrs_;
+	static std::unordered_map<pid_t, std::string>	children_;
 };
-#endif //YGGDRASILWM_SPAWN_HPP
\ No newline at end of file
+#endif //YGGDRASILWM_SPAWN_HPP
@@ -57,11 +57,25 @@ public:
  */
 	void	init_keycode(Display *display, BaseX11Wrapper *x11Wrapper);
 /**
- * @fn void Binding::execute()
+ * @fn void Binding::execute(const XKeyEvent *event, Client *target)
  * @brief Execute the command linked to the binding
- * The arguments passed to the command are the one stored in the binding
+ * The arguments of the binding were parsed by the command when the binding was initialized
+ * @param event the key event, may be null
+ * @param target the client targeted by the event, may be null
  */
-	void execute(const XKeyEvent *);
+	void execute(const XKeyEvent *event, Client *target = nullptr);
+/**
+ * @fn static unsigned int Binding::parseModMask(const std::string &mod)
+ * @brief parse modifiers names joined by '+' (Mod1, Mod4, Shift, Control), an empty string is no modifier
+ * @throw std::runtime_error on unknown modifier
+ */
+	static unsigned int					parseModMask(const std::string &mod);
+/**
+ * @fn static CommandBase *Binding::createCommand(const std::string &name)
+ * @brief instanciate the command named by an Action, the caller owns it
+ * @throw std::runtime_error on unknown command
+ */
+	static CommandBase					*createCommand(const std::string &name);
 	[[nodiscard]] const std::string &	getMod() const;
 	[[nodiscard]] const std::string &	getKey() const;
 	[[nodiscard]] const std::string &	getCommandName() const;
@@ -29,18 +29,58 @@
 #define YGGDRASILWM_CONFIGDATABINDINGS_HPP
 #include <string>
 #include <vector>
+#include <unordered_map>
+#include <cstdint>
 extern "C" {
 #include <X11/Xlib.h>
 }
 #include "json/json.h"
 #include "ConfigDataBase.hpp"
 #include "Config/Binding.hpp"
+/**
+ * @struct KeyStroke
+ * @brief one key of a binding sequence, the keycode is resolved by initKeycodes
+ */
+struct KeyStroke {
+	std::string		key;
+	unsigned int	mask;
+	int				keycode;
+};
+/**
+ * @struct KeySequence
+ * @brief the keys to type to execute a binding, in normal mode or in a mode
+ */
+struct KeySequence {
+	std::vector<KeyStroke>	strokes;
+	std::string				mode;
+	Binding					*binding;
+};
+/**
+ * @struct KeyNode
+ * @brief node of the key trie, edges are keyed by keycode and modifiers
+ * a node has either a binding (leaf) or children (prefix of a chord, or mode root)
+ */
+struct KeyNode {
+	std::unordered_map<uint64_t, uint32_t>	next;
+	Binding									*binding = nullptr;
+};
 /**
  * @class ConfigDataBindings
  * @brief ConfigDataBindings class.
  * This class is used to handle the bindings configuration
  * it instanciates the bindings in a vector
  * it handle grabbing keys and handle keypress events
+ * once the keycodes are known the bindings are compiled in a trie whose
+ * edges are keyed by keycode and modifiers, NumLock and CapsLock are ignored.
+ * The root of the trie holds the Mod+Key bindings, chords are paths of
+ * several keys and each mode has its own root. A key event is one lookup
+ * in the current node. Only the first keys of the normal bindings are
+ * grabbed, the whole keyboard is grabbed only while a chord is started or
+ * a mode is active.
+ *
+ * Json layout: every member is a modifier with its list of bindings, except
+ * "Modes" (object of mode name to list of bindings, Key may contain modifiers
+ * like "Shift+h") and "Chords" (list of bindings with a "Keys" array).
  */
 class ConfigDataBindings : public ConfigDataBase {
 public:
@@ -55,34 +95,146 @@ public:
 	void configInit(const Json::Value& root_) override;
 /**
  * @fn void ConfigDataBindings::initKeycodes(Display *display, BaseX11Wrapper *x11Wrapper)
- * @brief Initialize the keycodes
+ * @brief Initialize the keycodes and compile the key trie
  * This method is called by the WindowManager to initialize the keycodes after the
  * display and the x11Wrapper are initialized
  * @param display
  * @param x11Wrapper
  */
 	void initKeycodes(Display *display,BaseX11Wrapper *x11Wrapper);
+/**
+ * @fn void ConfigDataBindings::refreshKeycodes(Display *display, BaseX11Wrapper *x11Wrapper, const std::vector<Window> &windows)
+ * @brief Resolve the keycodes again after a MappingNotify
+ * the trie is compiled again only if a keycode or the NumLock modifier changed
+ * and only the grabs of the first keys that changed are replaced on the windows.
+ * @param display
+ * @param x11Wrapper
+ * @param windows the windows the keys were grabbed on
+ * @return the number of key sequences whose keycodes changed
+ */
+	size_t refreshKeycodes(Display *display, BaseX11Wrapper *x11Wrapper, const std::vector<Window> &windows);
+/**
+ * @fn void ConfigDataBindings::replaceGrabs(const ConfigDataBindings &previous, Display *display, BaseX11Wrapper *x11Wrapper, const std::vector<Window> &windows)
+ * @brief take over the grabs of the bindings replaced by a config reload
+ * the keys only bound by previous are ungrabbed and the new ones are grabbed,
+ * keys bound by both are left alone. initKeycodes must have been called.
+ * @param previous the bindings before the reload
+ * @param display
+ * @param x11Wrapper
+ * @param windows the windows the keys were grabbed on
+ */
+	void replaceGrabs(const ConfigDataBindings &previous, Display *display, BaseX11Wrapper *x11Wrapper,
+					  const std::vector<Window> &windows);
 	[[nodiscard]] Json::Value configSave() override;
 /**
  * @fn void ConfigDataBindings::grabKeys(Display *display, Window window)
- * @brief Grab the keys from the bindings
- * GrabKeys is called on the root window on initialisation of the
- * WindowManager and then on each new window creation that is managed
- * by the WindowManager
+ * @brief Grab the first key of the normal bindings, with every combination of NumLock and CapsLock
+ * GrabKeys is called once on the root window on initialisation of the
+ * WindowManager, the passive grabs of the root cover every client window
  * @param display
  * @param window
  */
 	void grabKeys(Display *display, Window window);
 /**
- * @fn void ConfigDataBindings::handleKeypressEvent(const XKeyEvent *event)
+ * @fn void ConfigDataBindings::handleKeypressEvent(const XKeyEvent *event, Client *target)
  * @brief Handle the keypress event
  * This method is called by the EventManager to avoid handling
  * bindings and their interface in the EventHandle class.
+ * follow the edge of the key from the current node of the trie, execute the
+ * binding of a leaf and go back to the root of the current mode.
  * @param event must be converted to const XKeyEvent *event
+ * @param target client targeted by the event, the one under the pointer or the focused one
+ */
+	void handleKeypressEvent(const XKeyEvent *event, Client *target = nullptr);
+/**
+ * @fn Binding *ConfigDataBindings::findBinding(unsigned int keycode, unsigned int state) const
+ * @brief look up a single key binding of the normal mode
+ * @param keycode
+ * @param state modifier state of the event, lock modifiers are ignored
+ * @return nullptr if no binding matches exactly
+ */
+	[[nodiscard]] Binding *findBinding(unsigned int keycode, unsigned int state) const;
+/**
+ * @fn unsigned int ConfigDataBindings::cleanMask(unsigned int state) const
+ * @brief keep only the modifiers used by the bindings, without NumLock, CapsLock and the buttons
  */
-	void handleKeypressEvent(const XKeyEvent *event);
+	[[nodiscard]] unsigned int cleanMask(unsigned int state) const;
+/**
+ * @fn unsigned int ConfigDataBindings::getNumLockMask() const
+ * @brief modifier of the NumLock key, to grab in every lock combination
+ */
+	[[nodiscard]] unsigned int getNumLockMask() const;
+/**
+ * @fn void ConfigDataBindings::enterMode(const std::string &name)
+ * @brief make a mode active and grab the keyboard, an empty or unknown name goes back to normal mode
+ */
+	void enterMode(const std::string &name);
+/**
+ * @fn const std::string &ConfigDataBindings::getActiveMode() const
+ * @brief name of the active mode, empty in normal mode
+ */
+	[[nodiscard]] const std::string &getActiveMode() const;
+/**
+ * @fn bool ConfigDataBindings::isKeyboardGrabbed() const
+ * @brief true while a mode is active or a chord is started
+ */
+	[[nodiscard]] bool isKeyboardGrabbed() const;
+/**
+ * @fn bool ConfigDataBindings::getFocusFollowsMouse() const
+ * @brief true when "FocusFollowsMouse" is set, the focus then follows the pointer between frames
+ */
+	[[nodiscard]] bool getFocusFollowsMouse() const;
 	[[nodiscard]] const std::vector<Binding *> &getBindings() const;
 private:
-	std::vector<Binding *> bindings_;
+/**
+ * @fn void ConfigDataBindings::compileTrie()
+ * @brief build the key trie from the sequences with resolved keycodes
+ */
+	void compileTrie();
+/**
+ * @fn void ConfigDataBindings::addBinding(...)
+ * @brief create a binding and the key sequence leading to it
+ */
+	void addBinding(const std::string &mod, const std::vector<std::string> &keys, const std::string &mode,
+					const Json::Value &binding);
+	static KeyStroke parseStroke(const std::string &stroke);
+	static int resolveKeycode(Display *display, BaseX11Wrapper *x11Wrapper, KeySym keysym);
+/**
+ * @fn void ConfigDataBindings::readModifierMapping()
+ * @brief find the NumLock modifier and the keycodes of the modifier keys
+ */
+	void readModifierMapping();
+/**
+ * @fn std::vector<uint64_t> ConfigDataBindings::rootEdges() const
+ * @brief sorted keys of the normal mode root, the keys to grab
+ */
+	[[nodiscard]] std::vector<uint64_t> rootEdges() const;
+/**
+ * @fn void ConfigDataBindings::replaceGrabs(const std::vector<uint64_t> &before, unsigned int oldNumLock, ...) const
+ * @brief ungrab the root keys that are no longer bound and grab the new ones
+ * @param before the sorted root keys grabbed until now
+ * @param oldNumLock the NumLock modifier they were grabbed with, all the keys are grabbed again if it changed
+ */
+	void replaceGrabs(const std::vector<uint64_t> &before, unsigned int oldNumLock, Display *display,
+					  BaseX11Wrapper *x11Wrapper, const std::vector<Window> &windows) const;
+	static uint64_t tableKey(unsigned int keycode, unsigned int mask);
+/**
+ * @fn void ConfigDataBindings::moveTo(uint32_t node)
+ * @brief change the current node of the trie, grab or release the keyboard if needed
+ */
+	void moveTo(uint32_t node);
+	std::vector<Binding *>					bindings_;
+	std::vector<KeySequence>				sequences_;
+	std::vector<KeyNode>					nodes_;
+	std::unordered_map<std::string, uint32_t>	modes_;
+	std::vector<bool>						modifierKeycodes_;
+	unsigned int							numLockMask_;
+	int										escapeKeycode_;
+	uint32_t								current_;
+	uint32_t								modeRoot_;
+	std::string								activeMode_;
+	bool									keyboardGrabbed_;
+	bool									focusFollowsMouse_;
+	Display									*display_;
 };
-#endif //YGGDRASILWM_CONFIGDATABINDINGS_HPP
\ No newline at end of file
+#endif //YGGDRASILWM_CONFIGDATABINDINGS_HPP
@@ -75,10 +75,25 @@ public:
  */
 	const Json::Value &getRoot();
 	std::string getConfigPath();
+/**
+ * @fn int ConfigFileHandler::watch()
+ * @brief Watch the configuration file with inotify
+ * The directory of the file is watched, so editors replacing the file
+ * by a rename are noticed too.
+ * @return a non blocking file descriptor to poll, -1 on failure
+ */
+	int watch();
+/**
+ * @fn bool ConfigFileHandler::fileChanged()
+ * @brief Read the pending inotify events
+ * @return true if one of them is a write or a rename of the configuration file
+ */
+	bool fileChanged();
 private:
 	static const std::vector<std::string> defaultPaths;
 	std::string configPath_;
 	Json::Value root_;
+	int watchFd_;
 /**
  * @fn std::string ConfigFileHandler::findConfigFile()
  * @brief Find the configuration file in the default paths
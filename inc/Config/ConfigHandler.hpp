@@ -32,6 +32,7 @@
 #include <string>
 #include <fstream>
 #include <unordered_map>
+#include <memory>
 #include "json/json.h"
 #include "ConfigDataBase.hpp"
 #include <variant>
@@ -40,6 +41,22 @@
 class ConfigData;
 
 class ConfigFileHandler;
+class ConfigDataGroups;
+class ConfigDataBars;
+class ConfigDataBindings;
+/**
+ * @struct ConfigReload
+ * @brief result of ConfigHandler::reload
+ * holds the configuration data replaced by the reload, a section left
+ * unchanged has a nullptr. previous is the Json root before the reload, to
+ * diff the groups and the bars one by one.
+ */
+struct ConfigReload {
+	Json::Value							previous;
+	std::shared_ptr<ConfigDataGroups>	groups;
+	std::shared_ptr<ConfigDataBars>		bars;
+	std::shared_ptr<ConfigDataBindings>	bindings;
+};
 /**
  * @class ConfigHandler
  * @brief ConfigHandler class
@@ -110,6 +127,28 @@ public:
  * Get the configFilePath form which the config has been read
  */
 	void configInit();
+/**
+ * @fn ConfigReload ConfigHandler::reload()
+ * @brief Read the configuration file again and replace the sections that changed
+ * The file is parsed in a new snapshot compared section by section (Groups,
+ * Bars, Bindings) with the current one, only the changed sections are parsed
+ * in new ConfigData objects. An invalid file or section is logged and the
+ * current configuration is kept.
+ * @return the replaced configuration data, for the WindowManager to apply the changes
+ */
+	ConfigReload reload();
+/**
+ * @fn int ConfigHandler::watchConfigFile()
+ * @brief start watching the configuration file
+ * @return file descriptor to poll, -1 on failure
+ */
+	int watchConfigFile();
+/**
+ * @fn bool ConfigHandler::configFileChanged()
+ * @brief read the events of the watch, true if the configuration file was written
+ */
+	bool configFileChanged();
+	[[nodiscard]] const Json::Value &getRoot() const;
 	~ConfigHandler();
 /**
  * @fn unsigned long ConfigHandler::colorCodeToULong(const std::string &colorCode)
@@ -121,6 +160,8 @@ public:
 
 private:
 	std::string configPath_;
+	std::unique_ptr<ConfigFileHandler> configFileHandler_;
+	Json::Value root_;
 	static ConfigHandler* instance_;
 	std::unordered_map<std::type_index, std::shared_ptr<ConfigDataBase>> configMap_;
 /**
@@ -136,5 +177,10 @@ private:
  * @param configPath
  */
 	explicit ConfigHandler(const std::string& configPath);
+/**
+ * @fn static bool ConfigHandler::checkRoot(const Json::Value &root)
+ * @brief true if the root has the Groups, Bars and Bindings sections
+ */
+	static bool checkRoot(const Json::Value &root);
 };
 #endif //YGGDRASILWM_CONFIGHANDLER_HPP
@@ -154,6 +154,7 @@ private:
 /**
  * @fn void EventHandler::handleEnterNotify(const XEvent& event)
  * @brief Handles the EnterNotify event.
+ * Redraw the bars, or hand the crossing of a frame to the focus follows mouse mode.
  * @param event
  */
 	void handleEnterNotify(const XEvent& event);
@@ -220,6 +221,21 @@ private:
  * @param event
  */
 	void handleMotionNotify(const XEvent& event);
+/**
+ * @fn void EventHandler::handleMappingNotify(const XEvent& event)
+ * @brief Handles the MappingNotify event.
+ * Refresh the keyboard mapping of Xlib and let the bindings replace the grabs
+ * of the keys whose keycode changed on the root window.
+ * @param event
+ */
+	void handleMappingNotify(const XEvent& event);
+/**
+ * @fn void EventHandler::handleScreenChange(const XEvent& event)
+ * @brief Handles the RandR RRScreenChangeNotify event.
+ * Its type is only known at runtime so dispatchEvent checks it before the array.
+ * @param event
+ */
+	void handleScreenChange(const XEvent& event);
 /**
  * @fn void EventHandler::handleUnknown(const XEvent& event)
  * @brief Handles the Unknown event.
@@ -32,6 +32,7 @@ extern "C" {
 #include <X11/Xatom.h>
 };
 #include <string>
+#include <vector>
 /**
  * @namespace ewmh
  * @brief ewmh namespace
@@ -46,11 +47,52 @@ namespace ewmh {
  * @todo add x11wrapper to the parameters
  */
 	void	initEwmh(Display *display, Window root);
+/**
+ * @fn void handleMessage(XClientMessageEvent *event, Display *display, Window root)
+ * @brief dispatch a client message through the handler table built by initEwmh
+ * _NET_ACTIVE_WINDOW, _NET_CURRENT_DESKTOP, _NET_WM_DESKTOP, _NET_WM_STATE (fullscreen)
+ * and _NET_CLOSE_WINDOW are handled, each request is applied as one layout batch.
+ */
 	void	handleMessage(XClientMessageEvent *event, Display *display, Window root);
 	void	updateNumberOfDesktops(Display *display, Window root);
 	void	updateWmProperties(Display *display, Window root);
 	void	updateDesktopGeometry(Display *display, Window root);
 	void	updateActiveWindow(Display *display, Window root, Window activeWindow);
+/**
+ * @fn void appendClientList(Display *display, Window root, Window client)
+ * @brief append a newly managed client at the end of _NET_CLIENT_LIST and on top of _NET_CLIENT_LIST_STACKING
+ */
+	void	appendClientList(Display *display, Window root, Window client);
+/**
+ * @fn void updateClientList(Display *display, Window root, const std::vector<Window> &clients)
+ * @brief replace _NET_CLIENT_LIST, clients are in mapping order
+ */
+	void	updateClientList(Display *display, Window root, const std::vector<Window> &clients);
+/**
+ * @fn void updateClientListStacking(Display *display, Window root, const std::vector<Window> &clients)
+ * @brief replace _NET_CLIENT_LIST_STACKING, clients are in bottom to top order
+ */
+	void	updateClientListStacking(Display *display, Window root, const std::vector<Window> &clients);
+/**
+ * @fn void updateWorkArea(Display *display, Window root, int x, int y, unsigned int width, unsigned int height, size_t desktops)
+ * @brief publish _NET_WORKAREA, the same area for each desktop
+ */
+/**
+ * @fn void updateCurrentDesktop(Display *display, Window root, size_t index)
+ * @brief publish the index of the active group in _NET_CURRENT_DESKTOP
+ */
+	void	updateCurrentDesktop(Display *display, Window root, size_t index);
+/**
+ * @fn void updateWmDesktop(Display *display, Window window, size_t index)
+ * @brief publish the group of a client in its _NET_WM_DESKTOP
+ */
+	void	updateWmDesktop(Display *display, Window window, size_t index);
+/**
+ * @fn void updateWmState(Display *display, Window window, bool fullscreen)
+ * @brief add or remove _NET_WM_STATE_FULLSCREEN in the _NET_WM_STATE of a client, other states are kept
+ */
+	void	updateWmState(Display *display, Window window, bool fullscreen);
+	void	updateWorkArea(Display *display, Window root, int x, int y, unsigned int width, unsigned int height, size_t desktops);
 };
 
 #endif //WINDOW_MANAGER_EWMH_HPP
\ No newline at end of file
@@ -150,6 +150,12 @@ public:
  * Set this group as active, switch the layout manager and map the clients
  */
 	void		switchTo();
+/**
+ * @fn void Group::show()
+ * @brief map the clients of the group without making it the active group
+ * used for the groups shown on the other outputs
+ */
+	void		show();
 /**
  * @fn void Group::switchFrom()
  * @brief Switch from this group
@@ -181,9 +187,24 @@ public:
  */
 	unsigned long	getActiveColor() const;
 	void resize (unsigned int sizeX, unsigned int sizeY, unsigned int posX, unsigned int posY);
+/**
+ * @fn void Group::resizeLater(unsigned int sizeX, unsigned int sizeY, unsigned int posX, unsigned int posY)
+ * @brief keep a new geometry for a hidden group, it is applied by switchTo
+ */
+	void resizeLater(unsigned int sizeX, unsigned int sizeY, unsigned int posX, unsigned int posY);
+/**
+ * @fn void Group::applyConfig(const std::shared_ptr<ConfigDataGroup> &config)
+ * @brief apply a reloaded configuration to the group
+ * the border colors and width of the clients are updated only if they changed
+ * and the clients are laid out again only if the border or the gap changed.
+ * The name and the layout are kept until restart.
+ * @param config
+ */
+	void applyConfig(const std::shared_ptr<ConfigDataGroup> &config);
 
 private:
 	std::string								name_;
+	std::string								layoutName_;
 	std::unordered_map<Window, std::shared_ptr<Client>>	clients_;
 	std::shared_ptr<LayoutManager>			layoutManager_;
 	int										borderSize_;
@@ -192,6 +213,8 @@ private:
 	unsigned long 							activeColor_;
 	int										barHeight_;
 	bool									active_{};
+	bool									resizePending_{};
+	unsigned int							pendingGeometry_[4]{};
 	std::shared_ptr<BaseX11Wrapper>			wrapper;
 };
 #endif //YGGDRASILWM_GROUP_H
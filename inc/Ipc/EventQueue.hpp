@@ -0,0 +1,81 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file EventQueue.hpp
+ * @brief EventQueue class header.
+ * @date 2026-10-19
+ */
+#ifndef YGGDRASILWM_EVENTQUEUE_HPP
+#define YGGDRASILWM_EVENTQUEUE_HPP
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <string>
+#include <utility>
+/**
+ * @class EventQueue
+ * @brief bounded queue of the serialized events waiting for one IPC subscriber
+ * An event pushed with a coalescing key replaces the pending event with the
+ * same key (the latest focus, the latest title of a window...), the replaced
+ * event is removed from its place and the new one is queued at the end so the
+ * order of the events is kept. When the queue is full the oldest event is
+ * dropped. Both cases are counted.
+ */
+class EventQueue {
+public:
+	explicit EventQueue(size_t capacity);
+/**
+ * @fn void EventQueue::push(std::string payload, const std::string &type, uint64_t key, bool coalesce)
+ * @brief queue an event, replacing the pending event of the same type and key if coalesce is true
+ */
+	void push(std::string payload, const std::string &type, uint64_t key, bool coalesce);
+/**
+ * @fn bool EventQueue::pop(std::string &payload)
+ * @brief take the oldest pending event
+ * @return false if the queue is empty
+ */
+	bool pop(std::string &payload);
+	[[nodiscard]] size_t size() const;
+	[[nodiscard]] size_t getCapacity() const;
+	[[nodiscard]] uint64_t getDropped() const;
+	[[nodiscard]] uint64_t getCoalesced() const;
+	[[nodiscard]] uint64_t getDelivered() const;
+private:
+	typedef std::pair<std::string, uint64_t> Key;
+	struct Entry {
+		std::string	payload;
+		Key			key;
+		bool		coalesce;
+		bool		live;
+	};
+	void dropFront();
+	void compact();
+	std::deque<Entry>		entries_;
+	std::map<Key, uint64_t>	pending_;
+	uint64_t				head_;
+	size_t					live_;
+	size_t					capacity_;
+	uint64_t				dropped_;
+	uint64_t				coalesced_;
+	uint64_t				delivered_;
+};
+#endif //YGGDRASILWM_EVENTQUEUE_HPP
@@ -0,0 +1,163 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file IpcServer.hpp
+ * @brief IpcServer class header.
+ * @date 2026-10-19
+ */
+#ifndef YGGDRASILWM_IPCSERVER_HPP
+#define YGGDRASILWM_IPCSERVER_HPP
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "json/json.h"
+#include "Ipc/EventQueue.hpp"
+
+class Client;
+class Group;
+class LayoutManager;
+/**
+ * @enum IpcTopic
+ * @brief events a client can subscribe to
+ */
+enum IpcTopic : unsigned int {
+	IPC_WINDOW = 1 << 0,
+	IPC_FOCUS = 1 << 1,
+	IPC_TITLE = 1 << 2,
+	IPC_GROUP = 1 << 3,
+	IPC_LAYOUT = 1 << 4
+};
+/**
+ * @class IpcServer
+ * @brief control channel on a unix domain socket served by the main loop
+ * Every message is a 32 bits big endian length followed by a JSON object.
+ * A request holds either a "Commands" array of {"Action", "Argument", "Target"}
+ * executed as one layout batch, or a "Query" among "groups", "clients" and
+ * "tree". The reply is {"Ok": bool, "Error": string, "Data": value}.
+ * The sockets are non blocking and the replies that cannot be written at once
+ * are kept until the client can read them, so a client never blocks the
+ * processing of the X events.
+ * A {"Subscribe": ["window", "focus", "title", "group", "layout"]} request
+ * turns the connection into an event stream. The events wait in a bounded
+ * EventQueue per subscriber and are only serialized into the socket buffer
+ * once the previous ones are written, so a slow reader gets the latest focus
+ * and titles instead of every intermediate state.
+ */
+class IpcServer {
+public:
+	explicit IpcServer(std::string path);
+	~IpcServer();
+	IpcServer(const IpcServer&) = delete;
+	IpcServer& operator=(const IpcServer&) = delete;
+/**
+ * @fn bool IpcServer::start()
+ * @brief bind and listen on the socket and watch it from the WindowManager main loop
+ * the socket is created with mode 0600 and connections from other users are refused
+ * @return false if the socket cannot be created, the error is logged
+ */
+	bool start();
+/**
+ * @fn void IpcServer::stop()
+ * @brief close the connections and remove the socket
+ */
+	void stop();
+/**
+ * @fn std::string IpcServer::handleRequest(const std::string &payload)
+ * @brief execute a request and return the JSON reply, never throws
+ * the commands are all created before any is executed, an unknown Action
+ * rejects the whole request.
+ */
+	std::string handleRequest(const std::string &payload);
+/**
+ * @fn static std::string IpcServer::encodeFrame(const std::string &payload)
+ * @brief prefix the payload with its length
+ */
+	static std::string encodeFrame(const std::string &payload);
+/**
+ * @fn static bool IpcServer::decodeFrame(std::string &buffer, std::string &payload)
+ * @brief extract the first complete message of buffer
+ * @return false if the buffer does not hold a complete message yet
+ * @throw std::runtime_error if the announced length is bigger than maxFrameSize
+ */
+	static bool decodeFrame(std::string &buffer, std::string &payload);
+/**
+ * @fn static std::string IpcServer::defaultPath(const std::string &display)
+ * @brief socket path for a display, in $XDG_RUNTIME_DIR or /tmp
+ */
+	static std::string defaultPath(const std::string &display);
+/**
+ * @fn bool IpcServer::wants(IpcTopic topic) const
+ * @brief true if a client subscribed to topic, used to skip building unused events
+ */
+	[[nodiscard]] bool wants(IpcTopic topic) const;
+/**
+ * @fn void IpcServer::publish(IpcTopic topic, uint64_t key, Json::Value event)
+ * @brief queue an event for the subscribers of topic
+ * the focus, title, group and layout events are coalesced by key,
+ * the window events are all delivered unless the queue overflows.
+ */
+	void publish(IpcTopic topic, uint64_t key, Json::Value event);
+/**
+ * @fn void IpcServer::clientEvent(IpcTopic topic, const Client *client, const std::string &change)
+ * @brief publish a window, focus or title event describing client
+ */
+	void clientEvent(IpcTopic topic, const Client *client, const std::string &change);
+/**
+ * @fn void IpcServer::groupEvent(const std::shared_ptr<Group> &group, size_t index)
+ * @brief publish the active group
+ */
+	void groupEvent(const std::shared_ptr<Group> &group, size_t index);
+/**
+ * @fn void IpcServer::layoutEvent(const LayoutManager *layout)
+ * @brief publish the group of layout after it committed a new geometry
+ */
+	void layoutEvent(const LayoutManager *layout);
+	[[nodiscard]] const std::string &getPath() const;
+	static const uint32_t maxFrameSize = 1 << 20;
+	static const size_t subscriberQueueSize = 256;
+private:
+	struct Connection {
+		std::string					input;
+		std::string					output;
+		unsigned int				topics = 0;
+		std::unique_ptr<EventQueue>	events;
+	};
+	std::string handleRequest(const std::string &payload, Connection *connection);
+	Json::Value subscribe(const Json::Value &topics, Connection *connection);
+	Json::Value subscribers() const;
+	static bool refill(Connection &connection);
+	void acceptClients();
+	void readClient(int fd);
+	void flushClient(int fd);
+	void closeClient(int fd);
+	Json::Value runCommands(const Json::Value &commands);
+	static Json::Value query(const std::string &what);
+	std::string								path_;
+	int										listenFd_;
+	std::unordered_map<int, Connection>		connections_;
+	unsigned int							topics_;
+	bool									handling_;
+	std::vector<int>						dirty_;
+};
+#endif //YGGDRASILWM_IPCSERVER_HPP
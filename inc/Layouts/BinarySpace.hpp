@@ -25,132 +25,159 @@
  * @date 2024-02-05
  */
 
-#include <memory>
-#include <stdexcept>
+#ifndef YGGDRASILWM_BINARYSPACE_HPP
+#define YGGDRASILWM_BINARYSPACE_HPP
+#include <cstdint>
 #include "Layouts/Point.hpp"
-class Client;
+/**
+ * @brief index of a space in the pool of its TreeLayoutManager
+ */
+using SpaceIndex = uint32_t;
+/**
+ * @brief stable handle of a client in its TreeLayoutManager
+ * a handle is valid from addClient to removeClient, whatever happens to the tree
+ */
+using ClientHandle = uint32_t;
+constexpr SpaceIndex	NO_SPACE = UINT32_MAX;
+constexpr ClientHandle	NO_CLIENT = UINT32_MAX;
 /**
  * @class BinarySpace
  * @brief BinarySpace class
  * This class represents a space in the layout.
  * it's designed like a binary tree, with a parent, a right and a left child.
  * Only leaf spaces have clients.
- * @todo create an interface for Spaces and implement it in BinarySpace
- * @todo redefine BinarySpace not as a nested class but as a separate class
+ * Spaces are stored in a contiguous pool owned by the TreeLayoutManager,
+ * parent and children are indices in this pool, NO_SPACE when there is none.
+ * @see TreeLayoutManager
  */
 class BinarySpace {
 private:
 	Point					pos_;
 	Point					size_;
-	int						index_;
+	SpaceIndex				index_;
 	int						subspace_count_;
-	BinarySpace*					parent_;
-	std::unique_ptr<BinarySpace>	right_;
-	std::unique_ptr<BinarySpace>	left_;
-	std::weak_ptr<Client>	client_;
+	SpaceIndex				parent_;
+	SpaceIndex				right_;
+	SpaceIndex				left_;
+	ClientHandle			client_;
+	bool					splitAlongX_;
 public:
 /**
- * @fn BinarySpace(Point pos, Point size, int index, BinarySpace* parent = nullptr)
+ * @fn BinarySpace(Point pos, Point size, SpaceIndex index, SpaceIndex parent = NO_SPACE)
  * @brief Construct a new BinarySpace object
  * @param pos
  * @param size
- * @param index
- * @param parent
+ * @param index index of the space in the pool
+ * @param parent index of the parent space
  */
-	BinarySpace(Point pos, Point size, int index, BinarySpace* parent = nullptr);
+	BinarySpace(Point pos, Point size, SpaceIndex index, SpaceIndex parent = NO_SPACE);
 	~BinarySpace() = default;
 /**
- * @fn const Point LayoutManager::BinarySpace::getPos()
+ * @fn const Point BinarySpace::getPos()
  * @brief Get the position of the space
  */
 	const Point &getPos() const;
 /**
- * @fn void LayoutManager::BinarySpace::setPos(const Point &pos)
+ * @fn void BinarySpace::setPos(const Point &pos)
  * @brief Set the position of the space
  * @param pos
  */
 	void setPos(const Point &pos);
 /**
- * @fn const Point LayoutManager::BinarySpace::getSize()
+ * @fn const Point BinarySpace::getSize()
  * @brief Get the size of the space
  * @return
  */
 	const Point &getSize() const;
 /**
- * @fn void LayoutManager::BinarySpace::setSize(const Point &size)
+ * @fn void BinarySpace::setSize(const Point &size)
  * @brief Set the size of the space
  * @param size
  */
-
 	void setSize(const Point &size);
 /**
- * @fn int LayoutManager::BinarySpace::getSubspaceCount()
- * @brief Get the number of subspaces
+ * @fn int BinarySpace::getSubspaceCount()
+ * @brief Get the number of leaves in the subtree of the space, 1 for a leaf
  */
 	int getSubspaceCount() const;
 /**
- * @fn int LayoutManager::BinarySpace::getIndex()
- * @brief Get the index of the space
- * @return
+ * @fn void BinarySpace::setSubspaceCount(int count)
+ * @brief Set the number of leaves in the subtree of the space
  */
-	int getIndex() const;
+	void setSubspaceCount(int count);
 /**
- * @fn void LayoutManager::BinarySpace::setIndex(int index)
- * @brief Set the index of the space
- * @param index
+ * @fn SpaceIndex BinarySpace::getIndex()
+ * @brief Get the index of the space in the pool
+ * @return
  */
-	void setIndex(int index);
+	SpaceIndex getIndex() const;
 /**
- * @fn BinarySpace * LayoutManager::BinarySpace::getParent()
- * @brief Get the parent of the space
+ * @fn SpaceIndex BinarySpace::getParent()
+ * @brief Get the parent of the space, NO_SPACE for the root space
  * @return
  */
-	BinarySpace *getParent() const;
+	SpaceIndex getParent() const;
 /**
- * @fn void LayoutManager::BinarySpace::setParent(BinarySpace *parent)
+ * @fn void BinarySpace::setParent(SpaceIndex parent)
  * @brief Set the parent of the space
  * @param parent
  */
-	void setParent(BinarySpace *parent);
+	void setParent(SpaceIndex parent);
 /**
- * @fn const std::unique_ptr<BinarySpace> & LayoutManager::BinarySpace::getRight()
+ * @fn SpaceIndex BinarySpace::getRight()
  * @brief Get the right child of the space
  * @return
  */
-	const std::unique_ptr<BinarySpace> &getRight() const;
+	SpaceIndex getRight() const;
 /**
- * @fn void LayoutManager::BinarySpace::setRight(std::unique_ptr<BinarySpace> right)
+ * @fn void BinarySpace::setRight(SpaceIndex right)
  * @brief Set the right child of the space
  * @param right
  */
-	void setRight(std::unique_ptr<BinarySpace> right);
+	void setRight(SpaceIndex right);
 /**
- * @fn const std::unique_ptr<BinarySpace> & LayoutManager::BinarySpace::getLeft()
+ * @fn SpaceIndex BinarySpace::getLeft()
  * @brief Get the left child of the space
  * @return
  */
-	const std::unique_ptr<BinarySpace> &getLeft() const;
+	SpaceIndex getLeft() const;
 /**
- * @fn void LayoutManager::BinarySpace::setLeft(std::unique_ptr<BinarySpace> left)
+ * @fn void BinarySpace::setLeft(SpaceIndex left)
  * @brief Set the left child of the space
  * @param left
  */
-	void setLeft(std::unique_ptr<BinarySpace> left);
+	void setLeft(SpaceIndex left);
 /**
- * @fn Client * LayoutManager::BinarySpace::getClient()
- * @brief Get the client of the space
+ * @fn ClientHandle BinarySpace::getClient()
+ * @brief Get the handle of the client of the space, NO_CLIENT if empty
  * @return
  */
-	std::shared_ptr<Client> getClient() const;
+	ClientHandle getClient() const;
 /**
- * @fn void LayoutManager::BinarySpace::setClient(Client *client)
+ * @fn void BinarySpace::setClient(ClientHandle client)
  * @brief Set the client of the space
  * @param client
  */
-	void setClient(std::shared_ptr<Client> client);
+	void setClient(ClientHandle client);
+/**
+ * @fn bool BinarySpace::isSplitAlongX()
+ * @brief true if the children are side by side, false if they are stacked
+ */
+	bool isSplitAlongX() const;
 /**
- * @fn void LayoutManager::BinarySpace::incSubSpaceCount()
+ * @fn void BinarySpace::setSplitAlongX(bool splitAlongX)
+ * @brief Set the axis of the split
+ */
+	void setSplitAlongX(bool splitAlongX);
+/**
+ * @fn void BinarySpace::incSubSpaceCount()
  * @brief Increment the number of subspaces
  */
 	void incSubSpaceCount();
-};
\ No newline at end of file
+/**
+ * @fn void BinarySpace::decSubSpaceCount()
+ * @brief Decrement the number of subspaces
+ */
+	void decSubSpaceCount();
+};
+#endif //YGGDRASILWM_BINARYSPACE_HPP
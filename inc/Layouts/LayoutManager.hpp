@@ -29,15 +29,33 @@
 #ifndef YGGDRASILWM_LAYOUTMANAGER_HPP
 #define YGGDRASILWM_LAYOUTMANAGER_HPP
 
+#include <functional>
 #include <memory>
 #include <stdexcept>
+#include <vector>
+#include <unordered_map>
 #include "Client.hpp"
 #include "Layouts/Point.hpp"
 class BaseX11Wrapper;
+/**
+ * @struct ClientRect
+ * @brief geometry of a client computed by a layout solver
+ * position and size of the frame, borders and gap already applied
+ */
+struct ClientRect {
+	Client			*client;
+	int				x;
+	int				y;
+	unsigned int	width;
+	unsigned int	height;
+};
 /**
  * @class LayoutManager
  * @brief LayoutManager class
  * Interface for the layout managers
+ * Layouts compute the geometry of their clients with solve, which does no
+ * X request, and apply it with commit which only sends what changed since
+ * the previous commit.
  */
 class LayoutManager {
 public:
@@ -50,9 +68,8 @@ public:
  * @param size_y
  * @param pos_x
  * @param pos_y
- * @param gap
  * @param border_size
- * @param bar_height
+ * @param gap
  */
 	LayoutManager(Display* display,
 				  Window root,
@@ -60,9 +77,9 @@ public:
 				  int size_y,
 				  int pos_x,
 				  int pos_y,
-				  int gap,
-				  int border_size);
-	virtual ~LayoutManager() = default;
+				  int border_size,
+				  int gap);
+	virtual ~LayoutManager();
 /**
  * @fn virtual void LayoutManager::updateGeometry()
  * @brief update the geometry of the layout used to resize the layout
@@ -81,6 +98,70 @@ public:
  * @param client
  */
 	virtual void removeClient(Client* client) = 0;
+/**
+ * @fn virtual void LayoutManager::solve(std::vector<ClientRect> &rects) const
+ * @brief compute the geometry of every client of the layout, without any X request
+ * @param rects cleared and filled with one rect per client
+ */
+	virtual void solve(std::vector<ClientRect> &rects) const = 0;
+/**
+ * @fn void LayoutManager::commit(const std::vector<ClientRect> &rects)
+ * @brief apply the rects to the clients
+ * fullscreen clients are left where they are
+ * only the geometry that changed since the last commit is sent,
+ * clients committed for the first time are raised
+ * @param rects
+ */
+	void commit(const std::vector<ClientRect> &rects);
+/**
+ * @fn static void LayoutManager::beginBatch()
+ * @brief defer the commits of every layout until the matching endBatch
+ * batches can be nested, the layouts changed during the batch are solved
+ * and committed once when the outermost batch ends.
+ */
+	static void beginBatch();
+/**
+ * @fn static void LayoutManager::endBatch()
+ * @brief end a batch, commit the layouts changed since the outermost beginBatch
+ */
+	static void endBatch();
+/**
+ * @fn static void LayoutManager::setCommitListener(std::function<void(const LayoutManager *)> listener)
+ * @brief called after each layout commit that is not deferred by a batch
+ */
+	static void setCommitListener(std::function<void(const LayoutManager *)> listener);
+/**
+ * @fn void LayoutManager::forgetClient(Client *client)
+ * @brief drop the committed geometry of a client leaving the layout
+ * @param client
+ */
+	void forgetClient(Client *client);
+/**
+ * @fn virtual void LayoutManager::focusClient(Client *client)
+ * @brief called before a client of the layout gets the focus
+ * layouts that do not show all their clients map it here
+ * @param client
+ */
+	virtual void focusClient(Client *client);
+/**
+ * @fn virtual bool LayoutManager::isVisible(Client *client) const
+ * @brief tell if the client must be mapped when its group is shown
+ * @param client
+ */
+	virtual bool isVisible(Client *client) const;
+/**
+ * @fn void LayoutManager::relayout()
+ * @brief solve and commit the layout again, used after forgetClient to place a client back
+ */
+	void relayout();
+/**
+ * @fn void LayoutManager::setSpacing(int borderSize, int gap)
+ * @brief change the border and the gap and lay the clients out again
+ * only the clients whose geometry changed are moved or resized
+ * @param borderSize
+ * @param gap
+ */
+	void setSpacing(int borderSize, int gap);
 protected:
 	int								screen_width_;
 	int								screen_height_;
@@ -89,5 +170,23 @@ protected:
 	int								space_count_;
 	Display							*display_;
 	Window							rootWindow_;
+	std::unordered_map<Client *, ClientRect>	committed_;
+	std::vector<ClientRect>			pending_;
+private:
+	bool							batched_;
+	static int						batchDepth_;
+	static std::vector<LayoutManager *>	batchedLayouts_;
+	static std::function<void(const LayoutManager *)>	commitListener_;
+};
+/**
+ * @class LayoutBatch
+ * @brief scope of a LayoutManager batch, the layouts are committed when it is destroyed
+ */
+class LayoutBatch {
+public:
+	LayoutBatch() { LayoutManager::beginBatch(); }
+	~LayoutBatch() { LayoutManager::endBatch(); }
+	LayoutBatch(const LayoutBatch&) = delete;
+	LayoutBatch& operator=(const LayoutBatch&) = delete;
 };
 #endif //YGGDRASILWM_LAYOUTMANAGER_HPP
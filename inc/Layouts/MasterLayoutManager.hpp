@@ -27,8 +27,24 @@
 #ifndef YGGDRASILWM_MASTERLAYOUTMANAGER_HPP
 #define YGGDRASILWM_MASTERLAYOUTMANAGER_HPP
 #include "Layouts/LayoutManager.hpp"
-class MasterSpace;
+#include "Layouts/MasterSpace.hpp"
+/**
+ * @class MasterLayoutManager
+ * @brief MasterLayoutManager class
+ * this class is a subclass of LayoutManager
+ * the first clients are placed in the master column, the others in the stack.
+ * Vertical layout puts the master on the left and the stack on the right,
+ * horizontal layout puts the master on top and the stack below.
+ * Adding or removing a stack client only commits the stack column, unless
+ * the stack becomes empty or is created which changes the master geometry.
+ */
 class MasterLayoutManager : public LayoutManager {
+public:
+/**
+ * @fn MasterLayoutManager(Display* display, Window root, int sizeX, int sizeY, int posX, int posY, int borderSize, int gap, int barHeight, bool vertical)
+ * @brief Construct a new Master Layout Manager object
+ * @param vertical true for a master column on the left, false for a master row on top
+ */
 	MasterLayoutManager(Display* display,
 						Window root,
 						int sizeX,
@@ -37,14 +53,63 @@ class MasterLayoutManager : public LayoutManager {
 						int posY,
 						int borderSize,
 						int gap,
-						int barHeight);
+						int barHeight,
+						bool vertical);
 	~MasterLayoutManager() override = default;
 	void updateGeometry(unsigned int sizeX, unsigned int sizeY, unsigned int posX, unsigned int posY) override;
 	void reSize(const Point &size,const Point &pos) override;
+/**
+ * @fn void MasterLayoutManager::addClient(std::shared_ptr<Client> client)
+ * @brief add a client to the master column if it is not full, at the end of the stack otherwise
+ */
 	void addClient(std::shared_ptr<Client> client) override;
+/**
+ * @fn void MasterLayoutManager::removeClient(Client *client)
+ * @brief remove a client, the first stack client replaces a removed master
+ */
 	void removeClient(Client *client) override;
+	void solve(std::vector<ClientRect> &rects) const override;
+/**
+ * @fn void MasterLayoutManager::setMasterCount(int count)
+ * @brief set the number of clients in the master column, at least 1
+ */
+	void setMasterCount(int count);
+/**
+ * @fn void MasterLayoutManager::setRatio(double ratio)
+ * @brief set the part of the area used by the master column, between 0.1 and 0.9
+ */
+	void setRatio(double ratio);
+/**
+ * @fn void MasterLayoutManager::setParams(int count, double ratio)
+ * @brief set the master count and ratio and commit once
+ */
+	void setParams(int count, double ratio);
+/**
+ * @fn void MasterLayoutManager::growMaster(int inc)
+ * @brief grow the master column by inc pixels
+ */
+	void growMaster(int inc);
+	int getMasterCount() const;
+	double getRatio() const;
+	const MasterSpace &getMasterSpace() const;
+	const MasterSpace &getStackSpace() const;
 private:
-	std::unique_ptr<MasterSpace> rootSpace_;
+/**
+ * @fn bool MasterLayoutManager::updateColumns()
+ * @brief compute the geometry of the columns from the area, the ratio and the clients
+ * @return true if the geometry of a column changed
+ */
+	bool updateColumns();
+	void applyMasterCount(int count);
+	void commitColumn(const MasterSpace &column);
+	void commitAll();
+	Point				pos_;
+	Point				size_;
+	bool				vertical_;
+	int					masterCount_;
+	double				ratio_;
+	MasterSpace			master_;
+	MasterSpace			stack_;
 };
 
-#endif // YGGDRASILWM_MASTERLAYOUTMANAGER_HPP
\ No newline at end of file
+#endif // YGGDRASILWM_MASTERLAYOUTMANAGER_HPP
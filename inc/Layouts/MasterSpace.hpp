@@ -28,49 +28,73 @@
 #ifndef YGGDRASILWM_MASTERSPACE_HPP
 #define YGGDRASILWM_MASTERSPACE_HPP
 #include "Layouts/Point.hpp"
-#include <memory>
+#include "Layouts/LayoutManager.hpp"
 #include <vector>
+#include <cstddef>
 class Client;
+/**
+ * @class MasterSpace
+ * @brief a column of the master layout (the master column or the stack)
+ * the clients of the column share its space equally, in order, one
+ * under the other when the column is vertical, side by side otherwise.
+ * @see MasterLayoutManager
+ */
 class MasterSpace {
 public:
-	MasterSpace(Point pos,
-				Point size,
-				int index,
-				bool master,
-				bool vertical,
-				MasterSpace* parent = nullptr);
+/**
+ * @fn MasterSpace(Point pos, Point size, bool vertical)
+ * @brief Construct a new MasterSpace object
+ * @param pos
+ * @param size
+ * @param vertical true if the clients are stacked vertically
+ */
+	MasterSpace(Point pos, Point size, bool vertical);
 	~MasterSpace();
 	const Point &getPos() const;
 	void setPos(const Point &pos);
 	const Point &getSize() const;
 	void setSize(const Point &size);
-	bool isMaster() const;
-	void setIsMaster(bool isMaster);
 	bool isVertical() const;
 	void setIsVertical(bool isVertical);
-	int getIndex() const;
-	void setIndex(int index);
-	int getSubspaceCount() const;
-	void setSubspaceCount(int subspaceCount);
-	MasterSpace *getParent() const;
-	void setParent(MasterSpace *parent);
-	MasterSpace *getMaster() const;
-	void setMaster(std::unique_ptr<MasterSpace>master);
-	const std::vector<std::unique_ptr<MasterSpace>> &getSlaves() const;
-	const std::weak_ptr<Client> &getClient() const;
-
-	void setClient(const std::weak_ptr<Client> &client);
-
+/**
+ * @fn bool MasterSpace::setGeometry(const Point &pos, const Point &size)
+ * @brief set the position and size of the column
+ * @return true if the geometry changed
+ */
+	bool setGeometry(const Point &pos, const Point &size);
+	const std::vector<Client *> &getClients() const;
+	size_t getClientCount() const;
+	bool hasClient(Client *client) const;
+/**
+ * @fn void MasterSpace::insertClient(size_t index, Client *client)
+ * @brief insert a client in the column, at the end if index is past the end
+ */
+	void insertClient(size_t index, Client *client);
+/**
+ * @fn bool MasterSpace::removeClient(Client *client)
+ * @brief remove a client from the column
+ * @return false if the client was not in the column
+ */
+	bool removeClient(Client *client);
+/**
+ * @fn Client *MasterSpace::takeFront()
+ * @brief remove and return the first client of the column
+ */
+	Client *takeFront();
+/**
+ * @fn Client *MasterSpace::takeBack()
+ * @brief remove and return the last client of the column
+ */
+	Client *takeBack();
+/**
+ * @fn void MasterSpace::solve(int borderSize, int gap, std::vector<ClientRect> &rects) const
+ * @brief append the geometry of the clients of the column to rects
+ */
+	void solve(int borderSize, int gap, std::vector<ClientRect> &rects) const;
 private:
 	Point										pos_;
 	Point										size_;
-	bool										is_master_;
 	bool										is_vertical_;
-	int											index_;
-	int											subspace_count_;
-	MasterSpace*								parent_;
-	std::unique_ptr<MasterSpace>				master_;
-	std::vector<std::unique_ptr<MasterSpace>>	slaves_;
-	std::weak_ptr<Client>						client_;
+	std::vector<Client *>						clients_;
 };
-#endif //YGGDRASILWM_MASTERSPACE_HPP
\ No newline at end of file
+#endif //YGGDRASILWM_MASTERSPACE_HPP
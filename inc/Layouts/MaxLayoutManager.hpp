@@ -0,0 +1,84 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file MaxLayoutManager.hpp
+ * @brief MaxLayoutManager class header.
+ * @date 2026-10-19
+ */
+#ifndef YGGDRASILWM_MAXLAYOUTMANAGER_HPP
+#define YGGDRASILWM_MAXLAYOUTMANAGER_HPP
+#include "Layouts/LayoutManager.hpp"
+#include <vector>
+/**
+ * @class MaxLayoutManager
+ * @brief monocle layout, only the focused client is mapped and uses the whole area
+ * the other clients of the group are unmapped until they get the focus, they
+ * are resized lazily when they are shown again.
+ */
+class MaxLayoutManager : public LayoutManager {
+public:
+	MaxLayoutManager(Display* display,
+					 Window root,
+					 int sizeX,
+					 int sizeY,
+					 int posX,
+					 int posY,
+					 int borderSize,
+					 int gap,
+					 int barHeight);
+	~MaxLayoutManager() override = default;
+	void updateGeometry(unsigned int sizeX, unsigned int sizeY, unsigned int posX, unsigned int posY) override;
+	void reSize(const Point &size,const Point &pos) override;
+/**
+ * @fn void MaxLayoutManager::addClient(std::shared_ptr<Client> client)
+ * @brief add a client to the layout, it becomes the visible client
+ */
+	void addClient(std::shared_ptr<Client> client) override;
+/**
+ * @fn void MaxLayoutManager::removeClient(Client *client)
+ * @brief remove a client, the previous client is shown if the removed one was visible
+ */
+	void removeClient(Client *client) override;
+/**
+ * @fn void MaxLayoutManager::solve(std::vector<ClientRect> &rects) const
+ * @brief only the visible client has a geometry
+ */
+	void solve(std::vector<ClientRect> &rects) const override;
+/**
+ * @fn void MaxLayoutManager::focusClient(Client *client)
+ * @brief unmap the visible client and show this one instead, it is only mapped if its group is shown
+ */
+	void focusClient(Client *client) override;
+	bool isVisible(Client *client) const override;
+/**
+ * @fn Client *MaxLayoutManager::nextClient(int step) const
+ * @brief return the client step positions after the visible one, wrapping around
+ */
+	Client *nextClient(int step) const;
+	Client *getVisibleClient() const;
+private:
+	Point					pos_;
+	Point					size_;
+	std::vector<Client *>	clients_;
+	Client					*visible_;
+};
+#endif //YGGDRASILWM_MAXLAYOUTMANAGER_HPP
@@ -30,6 +30,8 @@
 #define YGGDRASILWM_TREELAYOUTMANAGER_HPP
 #include "LayoutManager.hpp"
 #include <iostream>
+#include <vector>
+#include <unordered_map>
 #include "Layouts/BinarySpace.hpp"
 /**
  * @class TreeLayoutManager
@@ -40,6 +42,13 @@
  * the biggest space and splits it in two
  * placing the new client in the left space
  * and the old client in the right space
+ * Spaces are kept in a contiguous pool and linked by 32 bits indices,
+ * freed spaces are recycled through a free list.
+ * Clients are referenced by stable handles, the slot of a client keeps
+ * the index of its leaf space so lookups are O(1).
+ * Tree operations only modify spaces, the subtree they touched is then
+ * solved and committed, so only the clients of this subtree are sent
+ * X requests.
  */
 class TreeLayoutManager :public LayoutManager {
 public:
@@ -77,24 +86,49 @@ public:
 */
 	void	updateGeometry(unsigned int sizeX, unsigned int sizeY, unsigned int posX, unsigned int posY) override;
 	void	reSize(const Point &size, const Point &pos) override;
-	void	recursiveResize(const Point &size, const Point &pos, BinarySpace *space);
 /**
- * @fn BinarySpace* TreeLayoutManager::findSpace(Client* client)
+ * @fn void TreeLayoutManager::recursiveResize(const Point &size, const Point &pos, SpaceIndex space)
+ * @brief set the geometry of a space and split it between its children, no X request
+ */
+	void	recursiveResize(const Point &size, const Point &pos, SpaceIndex space);
+/**
+ * @fn void TreeLayoutManager::solve(std::vector<ClientRect> &rects) const
+ * @brief compute the geometry of every client of the tree
+ */
+	void	solve(std::vector<ClientRect> &rects) const override;
+/**
+ * @fn void TreeLayoutManager::solveSubtree(SpaceIndex space, std::vector<ClientRect> &rects) const
+ * @brief append the geometry of the clients of a subtree to rects
+ */
+	void	solveSubtree(SpaceIndex space, std::vector<ClientRect> &rects) const;
+/**
+ * @fn SpaceIndex TreeLayoutManager::findSpace(Client* client)
  * @brief find the space containing the client
- * it looks recursively for the space containing the client
+ * use the client index, O(1)
  * @param client
- * @return
+ * @return the leaf space of the client, NO_SPACE if the client is not in the layout
  */
-	BinarySpace	*findSpace(Client* client);
+	SpaceIndex	findSpace(Client* client) const;
 /**
- * @fn BinarySpace* TreeLayoutManager::findSpaceRecursive(Client* client, BinarySpace* space)
- * @brief recursive method to find the space containing the client
- * @param client
- * @param space
- * @return
+ * @fn const BinarySpace &TreeLayoutManager::getSpace(SpaceIndex index) const
+ * @brief access a space of the pool
+ */
+	const BinarySpace &getSpace(SpaceIndex index) const;
+/**
+ * @fn SpaceIndex TreeLayoutManager::getRootSpace() const
+ * @brief index of the root space
+ */
+	SpaceIndex getRootSpace() const;
+/**
+ * @fn size_t TreeLayoutManager::getPoolSize() const
+ * @brief number of spaces allocated in the pool, free spaces included
+ */
+	size_t getPoolSize() const;
+/**
+ * @fn std::shared_ptr<Client> TreeLayoutManager::getClient(ClientHandle handle) const
+ * @brief get the client referenced by a handle, nullptr if it no longer exists
  */
-	BinarySpace * findSpaceRecursive(Client *client, BinarySpace * space);
-	BinarySpace	*findSpace(int index);
+	std::shared_ptr<Client> getClient(ClientHandle handle) const;
 /**
  * @fn void TreeLayoutManager::addClient(Client* client)
  * @brief add a client to the layout
@@ -105,23 +139,23 @@ public:
  */
 	void	addClient(std::shared_ptr<Client> client) override;
 /**
- * @fn void TreeLayoutManager::removeClientRecursive(Client* client, BinarySpace* space)
- * @brief recursive method to add a client to the layout
+ * @fn SpaceIndex TreeLayoutManager::addClientRecursive(ClientHandle client, SpaceIndex space)
+ * @brief descend from space to the less populated branch and add the client there
  * @param client
  * @param space
+ * @return the space whose subtree changed
  */
-	void	addClientRecursive(std::shared_ptr<Client> client, BinarySpace *space);
+	SpaceIndex	addClientRecursive(ClientHandle client, SpaceIndex space);
 /**
- * @fn void TreeLayoutManager::placeClientInSpace(Client* client, BinarySpace* space)
- * @brief place a client in a space
- * moves and resizes the client window to fit the space
- * restack the client window
+ * @fn void TreeLayoutManager::placeClientInSpace(ClientHandle client, SpaceIndex space)
+ * @brief place a client in a leaf space
+ * update the space and the client index, the window is moved by the next commit
  * @param client
  * @param space
  */
-	void	placeClientInSpace(const std::shared_ptr<Client>& client, BinarySpace *space);
+	void	placeClientInSpace(ClientHandle client, SpaceIndex space);
 /**
- * @fn void TreeLayoutManager::splitSpace(Client* client, BinarySpace* space, bool splitAlongX)
+ * @fn void TreeLayoutManager::splitSpace(ClientHandle client, SpaceIndex space, bool splitAlongX)
  * @brief split a space in two
  * Move the client to the left space and the old client to the right space
  * increase the subspaces counter of all the parent spaces
@@ -129,31 +163,56 @@ public:
  * @param space
  * @param splitAlongX
  */
-	void	splitSpace(const std::shared_ptr<Client>& client, BinarySpace *space, bool splitAlongX);
+	void	splitSpace(ClientHandle client, SpaceIndex space, bool splitAlongX);
 /**
  * @fn void TreeLayoutManager::removeClient(Client* client)
  * @brief remove a client from the layout
- * use the recursive method to remove the client
+ * the leaf of the client is found with the client index
  * @param client
  */
 	void	removeClient(Client *client) override;
 /**
- * @fn void TreeLayoutManager::removeClientRecursive(Client* client, BinarySpace* space)
- * @brief recursive method to remove a client from the layout
+ * @fn void TreeLayoutManager::removeClientFromSpace(ClientHandle client, SpaceIndex space)
+ * @brief remove a client from its leaf space
+ * the sibling of the leaf (client or whole subtree) is promoted into the
+ * parent space and only this subtree is laid out again in the parent geometry.
+ * The leaf counts of the ancestors are decremented, O(depth).
  * @param client
  * @param space
  */
-	void	removeClientRecursive(Client *client, BinarySpace* space);
+	void	removeClientFromSpace(ClientHandle client, SpaceIndex space);
 /**
  * @fn void TreeLayoutManager::growSpace(Client* client)
- * @brief grow the space of the client in the x axis
- * @todo this method is not implemented yet
+ * @brief grow the space of the client along the axis of its parent split
  * @param client
  */
 	void growSpace(Client *client, int inc);
-	void recursiveShrinkSiblingSpace(BinarySpace *space, int inc, bool vertical);
+	void recursiveShrinkSiblingSpace(SpaceIndex space, int inc, bool vertical);
 private:
-	std::unique_ptr<BinarySpace>			rootSpace_;
-	void deleteSpace(BinarySpace *space);
+/**
+ * @struct ClientSlot
+ * @brief client referenced by a ClientHandle
+ */
+	struct ClientSlot {
+		std::weak_ptr<Client>	client;
+		Client					*raw;
+		SpaceIndex				space;
+	};
+/**
+ * @fn void TreeLayoutManager::commitSubtree(SpaceIndex space)
+ * @brief solve the subtree of space and commit it
+ */
+	void		commitSubtree(SpaceIndex space);
+	ClientRect	clientRect(ClientHandle client, const BinarySpace &space) const;
+	SpaceIndex	allocSpace(const Point &pos, const Point &size, SpaceIndex parent);
+	void		freeSpace(SpaceIndex space);
+	ClientHandle acquireClient(const std::shared_ptr<Client> &client);
+	void		releaseClient(ClientHandle client);
+	std::vector<BinarySpace>					spaces_;
+	std::vector<SpaceIndex>						freeSpaces_;
+	std::vector<ClientSlot>						clientSlots_;
+	std::vector<ClientHandle>					freeClients_;
+	std::unordered_map<Client *, ClientHandle>	clientIndex_;
+	SpaceIndex									rootSpace_;
 };
 #endif //YGGDRASILWM_TREELAYOUTMANAGER_HPP
@@ -0,0 +1,81 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file Outputs.hpp
+ * @brief Outputs class header.
+ * @date 2026-10-19
+ */
+#ifndef YGGDRASILWM_OUTPUTS_HPP
+#define YGGDRASILWM_OUTPUTS_HPP
+#include "X11wrapper/baseX11Wrapper.hpp"
+#include "WorkArea.hpp"
+#include <cstddef>
+#include <vector>
+/**
+ * @class Outputs
+ * @brief the monitors of the screen and the group shown on each of them
+ * Outputs are matched by name when the RandR configuration changes, so an
+ * output that did not move keeps its group and its layout untouched.
+ * The area of an output is its part of the work area, the window manager
+ * only lays a group out again when the area of its output changed.
+ */
+class Outputs {
+public:
+	static const size_t none;
+	Outputs();
+/**
+ * @fn std::vector<size_t> Outputs::update(const std::vector<OutputGeometry> &geometries, std::vector<size_t> &released)
+ * @brief replace the outputs by a new RandR configuration
+ * @param geometries the outputs, the first one is the primary output
+ * @param released receives the groups of the outputs that disappeared
+ * @return the indexes of the outputs that appeared or moved
+ */
+	std::vector<size_t> update(const std::vector<OutputGeometry> &geometries, std::vector<size_t> &released);
+/**
+ * @fn bool Outputs::setArea(size_t output, const WorkArea &workArea)
+ * @brief clip an output to the work area
+ * @return true if the area of the output changed since the last call
+ */
+	bool setArea(size_t output, const WorkArea &workArea);
+	[[nodiscard]] size_t size() const;
+	[[nodiscard]] const OutputGeometry &getGeometry(size_t output) const;
+	[[nodiscard]] const OutputGeometry &getArea(size_t output) const;
+	[[nodiscard]] size_t getGroup(size_t output) const;
+	void setGroup(size_t output, size_t group);
+/**
+ * @fn size_t Outputs::find(size_t group) const
+ * @brief the output showing a group
+ * @return the index of the output or Outputs::none
+ */
+	[[nodiscard]] size_t find(size_t group) const;
+	[[nodiscard]] size_t getFocused() const;
+	void setFocused(size_t output);
+private:
+	struct Output {
+		OutputGeometry	geometry;
+		OutputGeometry	area;
+		size_t			group;
+	};
+	std::vector<Output>	outputs_;
+	size_t				focused_;
+};
+#endif //YGGDRASILWM_OUTPUTS_HPP
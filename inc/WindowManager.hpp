@@ -31,13 +31,19 @@ extern "C" {
 #include <X11/Xlib.h>
 }
 #include <memory>
+#include <functional>
+#include <vector>
 #include <string>
 #include <unordered_map>
 #include <chrono>
+#include <poll.h>
 #include "Logger.hpp"
 #include "Client.hpp"
 #include "Layouts/TreeLayoutManager.hpp"
 #include "Config/ConfigHandler.hpp"
+#include "Bars/BarsDataValue.hpp"
+#include "WorkArea.hpp"
+#include "Outputs.hpp"
 #include <iostream>
 #include <algorithm>
 #include <csignal>
@@ -46,6 +52,7 @@ extern "C" {
 class Group;
 class TSBarsData;
 class BaseX11Wrapper;
+class IpcServer;
 
 /**
  * @class WindowManager
@@ -128,6 +135,108 @@ public:
  * @param window
  */
 	void		insertClient(Window window);
+/**
+ * @fn void WindowManager::addToClientList(Window window)
+ * @brief append a managed client to the EWMH client lists, the properties are appended at once
+ */
+	void		addToClientList(Window window);
+/**
+ * @fn void WindowManager::removeFromClientList(Window window)
+ * @brief remove a client from the EWMH client lists, the properties are rewritten by flushClientLists
+ */
+	void		removeFromClientList(Window window);
+/**
+ * @fn void WindowManager::flushClientLists()
+ * @brief rewrite the EWMH client lists changed by removals or restacks, once per event cycle
+ */
+	void		flushClientLists();
+/**
+ * @fn bool WindowManager::manageDock(Window window)
+ * @brief map a dock window without framing it and reserve its strut
+ * a window is a dock if its _NET_WM_WINDOW_TYPE is _NET_WM_WINDOW_TYPE_DOCK or if it has a strut
+ * @return false if the window is not a dock
+ */
+	bool		manageDock(Window window);
+/**
+ * @fn bool WindowManager::updateDock(Window window, Atom property)
+ * @brief read the strut of a dock again after a change of _NET_WM_STRUT or _NET_WM_STRUT_PARTIAL
+ * @return false if the window is not a dock
+ */
+	bool		updateDock(Window window, Atom property);
+/**
+ * @fn bool WindowManager::forgetDock(Window window)
+ * @brief release the strut of a dock window that is unmapped or destroyed
+ * @return false if the window is not a dock
+ */
+	bool		forgetDock(Window window);
+	[[nodiscard]] const WorkArea &	getWorkArea() const;
+	[[nodiscard]] const Outputs &	getOutputs() const;
+/**
+ * @fn int WindowManager::getScreenChangeEvent() const
+ * @brief event type of the RandR screen change notifications, -1 without RandR
+ */
+	[[nodiscard]] int	getScreenChangeEvent() const;
+/**
+ * @fn Atom WindowManager::getProtocolsAtom() const
+ * @brief the WM_PROTOCOLS atom interned at startup
+ */
+	[[nodiscard]] Atom	getProtocolsAtom() const;
+/**
+ * @fn void WindowManager::updateOutputs(XEvent &event)
+ * @brief apply a RandR screen change
+ * Only the groups of the outputs that appeared, moved or lost space are laid
+ * out again, the groups of the outputs that disappeared are hidden and the
+ * clients are never adopted again.
+ */
+	void		updateOutputs(XEvent &event);
+/**
+ * @fn void WindowManager::switchToGroup(size_t index)
+ * @brief hide the active group and show the group at index
+ */
+	void		switchToGroup(size_t index);
+/**
+ * @fn void WindowManager::moveClientToGroup(Client *client, size_t index)
+ * @brief move a client to the group at index, it is hidden if that group is not active
+ */
+	void		moveClientToGroup(Client *client, size_t index);
+/**
+ * @fn void WindowManager::setFullscreen(Client *client, bool fullscreen)
+ * @brief cover the whole screen with the client, or give it back to its layout
+ */
+	void		setFullscreen(Client *client, bool fullscreen);
+/**
+ * @fn size_t WindowManager::getGroupIndex(const std::shared_ptr<Group> &group) const
+ * @brief index of a group, the number of groups if it is unknown
+ */
+	[[nodiscard]] size_t	getGroupIndex(const std::shared_ptr<Group> &group) const;
+/**
+ * @fn void WindowManager::pingClients()
+ * @brief called by the ping timer, send _NET_WM_PING to the clients and mark the silent ones hung
+ */
+	void		pingClients();
+/**
+ * @fn void WindowManager::setFocusFollowsMouse(bool enabled)
+ * @brief select EnterNotify on the frames and focus the frame under the pointer
+ */
+	void		setFocusFollowsMouse(bool enabled);
+/**
+ * @fn void WindowManager::pointerEntered(const XCrossingEvent &event)
+ * @brief remember the frame under the pointer, it gets the focus once the pointer rested on it
+ * The crossings caused by our own layouts and restacks are recognised by their serial and
+ * ignored, a sweep across many frames only re-arms the dwell timer.
+ */
+	void		pointerEntered(const XCrossingEvent &event);
+/**
+ * @fn void WindowManager::ignoreCrossings()
+ * @brief ignore the crossings caused by the requests sent so far
+ */
+	void		ignoreCrossings();
+/**
+ * @fn bool WindowManager::handlePong(const XClientMessageEvent &event)
+ * @brief handle the answer of a client to _NET_WM_PING
+ * @return false if the message is not a _NET_WM_PING answer
+ */
+	bool		handlePong(const XClientMessageEvent &event);
 // Running control
 /**
  * @fn void WindowManager::Stop()
@@ -219,6 +328,38 @@ public:
  * @brief get the X11 Wrapper object
  */
 	const std::shared_ptr<BaseX11Wrapper> &	getX11Wrapper() const;
+/**
+ * @fn IpcServer *WindowManager::getIpcServer() const
+ * @brief IPC server used to publish the events, nullptr if the socket could not be created
+ */
+	[[nodiscard]] IpcServer *				getIpcServer() const;
+/**
+ * @fn void WindowManager::watchFd(int fd, std::function<void()> callback, short events)
+ * @brief call callback from the main loop each time fd is ready
+ * the main loop polls the X connection and the watched file descriptors
+ * @param fd
+ * @param callback
+ * @param events poll events to wait for, POLLIN by default
+ */
+	void									watchFd(int fd, std::function<void()> callback, short events = POLLIN);
+/**
+ * @fn void WindowManager::setWatchedEvents(int fd, short events)
+ * @brief change the poll events of a watched fd, to wait for POLLOUT while output is pending
+ */
+	void									setWatchedEvents(int fd, short events);
+/**
+ * @fn void WindowManager::unwatchFd(int fd)
+ * @brief stop watching fd, does not close it
+ */
+	void									unwatchFd(int fd);
+/**
+ * @fn void WindowManager::reloadConfig()
+ * @brief reload the configuration file and apply only what changed
+ * called from the main loop when the watched config file is written,
+ * the changed bindings are grabbed again, the changed groups are laid out
+ * again and the changed bars are rebuilt.
+ */
+	void									reloadConfig();
 private:
 	Display									*display_;
 	static bool								wmDetected;
@@ -227,14 +368,45 @@ private:
 	std::weak_ptr<Group>					active_group_{};
 	const Atom								WM_PROTOCOLS;
 	const Atom								WM_DELETE_WINDOW;
+	const Atom								NET_WM_STRUT;
+	const Atom								NET_WM_STRUT_PARTIAL;
+	const Atom								NET_WM_WINDOW_TYPE;
+	const Atom								NET_WM_WINDOW_TYPE_DOCK;
+	const Atom								NET_WM_PING;
+	WorkArea								workArea_;
+	Outputs									outputs_;
+	int										screenChangeEvent_;
 	unsigned int							geometryX{};
 	unsigned int							geometryY{};
 	bool									running;
 	std::unordered_map<Window, std::shared_ptr<Client>>		clients_;
 	static WindowManager *					instance_;
 	std::shared_ptr<TSBarsData>				tsData;
+	BarsChannel								groupsChannel;
+	BarsChannel								activeGroupChannel;
+	BarsChannel								evCountChannel;
 	Window									activeWindow;
 	std::shared_ptr<BaseX11Wrapper>			x11Wrapper;
+	struct WatchedFd {
+		int						fd;
+		short					events;
+		std::function<void()>	callback;
+	};
+	std::vector<WatchedFd>					watchedFds_;
+	std::unique_ptr<IpcServer>				ipcServer_;
+	std::vector<Window>						clientList_;
+	std::vector<Window>						stackingList_;
+	bool									clientListDirty_;
+	int										pingTimerFd_;
+	static const long						pingInterval = 5; // seconds a client has to answer a ping
+	Time									pingTimestamp_;
+	BarsChannel								hungChannel;
+	int										childSignalFd_;
+	bool									focusFollowsMouse_;
+	int										focusTimerFd_;
+	static const long						focusDelay = 40; // milliseconds the pointer rests on a frame before it gets the focus
+	Window									pendingFocus_;
+	unsigned long							crossingSerial_;
 // Initialisation
 /**
  * @fn WindowManager::WindowManager(Display *display, const Logger &logger,ConfigHandler &configHandler)
@@ -251,6 +423,25 @@ private:
  * @brief look for existing top level windows and create clients for them
  */
 	void		getTopLevelWindows();
+/**
+ * @fn void WindowManager::applyWorkArea()
+ * @brief resize the active group to the work area at once and the hidden ones when they are shown, publish _NET_WORKAREA
+ */
+	void		applyWorkArea();
+	std::vector<OutputGeometry>	readOutputs() const;
+	void		placeGroup(size_t output);
+/**
+ * @fn bool WindowManager::readStrut(Window window, Strut &strut) const
+ * @brief read _NET_WM_STRUT_PARTIAL or else _NET_WM_STRUT
+ * @return false if the window has no strut
+ */
+	bool		readStrut(Window window, Strut &strut) const;
+	bool		isDockType(Window window) const;
+/**
+ * @fn void WindowManager::publishHung()
+ * @brief publish the names of the groups holding a hung client on the Hung channel
+ */
+	void		publishHung();
 // Error Management
 /**
  * @fn static int WindowManager::OnXError(Display *display, XErrorEvent *e)
@@ -277,6 +468,11 @@ private:
  * @note communication between main thread and Bars thread is handled in Thread Safe way by the TSBarsData class
  */
 	void		createBars();
+/**
+ * @fn void WindowManager::resizeGroups()
+ * @brief give the groups the screen area left by the bars
+ */
+	void		resizeGroups();
 };
 
 void handleSIGHUP(int signal);
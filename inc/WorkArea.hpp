@@ -0,0 +1,96 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file WorkArea.hpp
+ * @brief WorkArea class header.
+ * @date 2026-10-19
+ */
+#ifndef YGGDRASILWM_WORKAREA_HPP
+#define YGGDRASILWM_WORKAREA_HPP
+#include <unordered_map>
+extern "C" {
+#include <X11/Xlib.h>
+}
+/**
+ * @struct Strut
+ * @brief space reserved on each edge of the screen
+ */
+struct Strut {
+	unsigned long	left = 0;
+	unsigned long	right = 0;
+	unsigned long	top = 0;
+	unsigned long	bottom = 0;
+	bool operator==(const Strut &other) const {
+		return left == other.left && right == other.right && top == other.top && bottom == other.bottom;
+	}
+	bool operator!=(const Strut &other) const { return !(*this == other); }
+};
+/**
+ * @class WorkArea
+ * @brief area of the screen left to the layouts by the bars and the docks
+ * The bars of the Window Manager reserve a base strut and each dock window
+ * its own _NET_WM_STRUT(_PARTIAL), the reserved space on an edge is the
+ * biggest strut on that edge. The setters report whether the reserved space
+ * changed so the groups are only resized when needed.
+ */
+class WorkArea {
+public:
+	WorkArea(unsigned int width, unsigned int height);
+/**
+ * @fn bool WorkArea::setScreenSize(unsigned int width, unsigned int height)
+ * @brief change the size of the screen
+ * @return true if the work area changed
+ */
+	bool setScreenSize(unsigned int width, unsigned int height);
+/**
+ * @fn bool WorkArea::setBase(const Strut &strut)
+ * @brief set the space reserved by the bars
+ * @return true if the reserved space changed
+ */
+	bool setBase(const Strut &strut);
+/**
+ * @fn bool WorkArea::setStrut(Window window, const Strut &strut)
+ * @brief set the strut of a dock window, an empty strut still tracks the window
+ * @return true if the reserved space changed
+ */
+	bool setStrut(Window window, const Strut &strut);
+/**
+ * @fn bool WorkArea::removeStrut(Window window)
+ * @brief forget a dock window
+ * @return true if the reserved space changed
+ */
+	bool removeStrut(Window window);
+	[[nodiscard]] bool isDock(Window window) const;
+	[[nodiscard]] const Strut &getReserved() const;
+	[[nodiscard]] int getX() const;
+	[[nodiscard]] int getY() const;
+	[[nodiscard]] unsigned int getWidth() const;
+	[[nodiscard]] unsigned int getHeight() const;
+private:
+	bool recompute();
+	unsigned int						width_;
+	unsigned int						height_;
+	Strut								base_;
+	Strut								reserved_;
+	std::unordered_map<Window, Strut>	struts_;
+};
+#endif //YGGDRASILWM_WORKAREA_HPP
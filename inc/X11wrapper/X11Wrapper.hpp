@@ -56,6 +56,14 @@ public:
 	int queryTree(Display * display, Window window, Window * rootReturn, Window * parentReturn, Window ** childrenReturn, unsigned int * nChildrenReturn) override;
 	int freeX(void * data) override;
 	int nextEvent(Display * display, XEvent * eventReturn) override;
+	int pending(Display * display) override;
+	int connectionNumber(Display * display) override;
+	int refreshKeyboardMapping(XMappingEvent * event) override;
+	int killClient(Display * display, XID resource) override;
+	unsigned long nextRequest(Display * display) override;
+	int selectScreenChanges(Display * display, Window window) override;
+	int updateScreenConfiguration(XEvent * event) override;
+	int getMonitors(Display * display, Window window, std::vector<OutputGeometry> & outputs) override;
 	int sendEvent(Display * display, Window window, bool propagate, long eventMask, XEvent * event_send) override;
 	int changeProperty(Display * display, Window window, Atom property, Atom type, int format, int mode, const unsigned char * data, int nelements) override;
 	int getProperty(Display * display, Window window, Atom property, long longOffset, long longLength, bool delete_, Atom reqType, Atom * actualTypeReturn, int * actualFormatReturn, unsigned long * nitemsReturn, unsigned long * bytesAfterReturn, unsigned char ** propReturn) override;
@@ -33,6 +33,23 @@ extern "C" {
 };
 #include <memory>
 #include <string>
+#include <vector>
+
+/**
+ * @struct OutputGeometry
+ * @brief name and position of a monitor in root coordinates
+ */
+struct OutputGeometry {
+	std::string		name;
+	int				x = 0;
+	int				y = 0;
+	unsigned int	width = 0;
+	unsigned int	height = 0;
+	bool operator==(const OutputGeometry &other) const {
+		return name == other.name && x == other.x && y == other.y && width == other.width && height == other.height;
+	}
+	bool operator!=(const OutputGeometry &other) const { return !(*this == other); }
+};
 
 class BaseX11Wrapper {
 public:
@@ -54,6 +71,14 @@ public:
 	virtual int queryTree(Display * display, Window window, Window * rootReturn, Window * parentReturn, Window ** childrenReturn, unsigned int * nChildrenReturn) = 0;
 	virtual int freeX(void * data) = 0;
 	virtual int nextEvent(Display * display, XEvent * event_return) = 0;
+	virtual int pending(Display * display) = 0;
+	virtual int connectionNumber(Display * display) = 0;
+	virtual int refreshKeyboardMapping(XMappingEvent * event) = 0;
+	virtual int killClient(Display * display, XID resource) = 0;
+	virtual unsigned long nextRequest(Display * display) = 0;
+	virtual int selectScreenChanges(Display * display, Window window) = 0;
+	virtual int updateScreenConfiguration(XEvent * event) = 0;
+	virtual int getMonitors(Display * display, Window window, std::vector<OutputGeometry> & outputs) = 0;
 	virtual int sendEvent(Display * display, Window window, bool propagate, long eventMask, XEvent * event_send) = 0;
 	virtual int changeProperty(Display * display, Window window, Atom property, Atom type, int format, int mode, const unsigned char * data, int nelements) = 0;
 	virtual int getProperty(Display * display, Window window, Atom property, long long_offset, long long_length, bool delete_, Atom req_type, Atom * actual_type_return, int * actual_format_return, unsigned long * nitems_return, unsigned long * bytes_after_return, unsigned char ** prop_return) = 0;
@@ -22,6 +22,14 @@ public:
 	MOCK_METHOD(int, queryTree, (Display *, Window, Window *, Window *, Window **, unsigned int *), (override));
 	MOCK_METHOD(int, freeX, (void *), (override));
 	MOCK_METHOD(int, nextEvent, (Display *, XEvent *), (override));
+	MOCK_METHOD(int, pending, (Display *), (override));
+	MOCK_METHOD(int, connectionNumber, (Display *), (override));
+	MOCK_METHOD(int, refreshKeyboardMapping, (XMappingEvent *), (override));
+	MOCK_METHOD(int, killClient, (Display *, XID), (override));
+	MOCK_METHOD(unsigned long, nextRequest, (Display *), (override));
+	MOCK_METHOD(int, selectScreenChanges, (Display *, Window), (override));
+	MOCK_METHOD(int, updateScreenConfiguration, (XEvent *), (override));
+	MOCK_METHOD(int, getMonitors, (Display *, Window, std::vector<OutputGeometry> &), (override));
 	MOCK_METHOD(int, sendEvent, (Display *, Window, bool, long, XEvent *), (override));
 	MOCK_METHOD(int, changeProperty, (Display *, Window, Atom, Atom, int, int, const unsigned char *, int), (override));
 	MOCK_METHOD(int, getProperty, (Display *, Window, Atom, long, long, bool, Atom, Atom *, int *, unsigned long *, unsigned long *, unsigned char **), (override));
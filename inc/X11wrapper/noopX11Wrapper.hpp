@@ -0,0 +1,77 @@
+#include <cstddef>
+#include "X11wrapper/baseX11Wrapper.hpp"
+
+/**
+ * @class noopX11Wrapper
+ * @brief X11 wrapper that does nothing but count the requests, used by the benchmarks
+ * getWindowProperty answers a fixed WM_CLASS so clients can be built without a display.
+ */
+class noopX11Wrapper : public BaseX11Wrapper {
+public:
+	noopX11Wrapper() = default;
+	~noopX11Wrapper() override = default;
+	size_t requests = 0;
+	Display * openDisplay() override { return nullptr; }
+	Display * openDisplay(const char *) override { return nullptr; }
+	void closeDisplay(Display *) override {}
+	int defaultScreen(Display *) override { return 0; }
+	Window rootWindow(Display *, int) override { return 0; }
+	Atom internAtom(Display *, const char *, bool) override { requests++; return 0; }
+	int displayWidth(Display *, int) override { return 1920; }
+	int displayHeight(Display *, int) override { return 1080; }
+	int grabServer(Display *) override { return requests++, 0; }
+	int ungrabServer(Display *) override { return requests++, 0; }
+	int flush(Display *) override { return 0; }
+	XErrorHandler setErrorHandler(XErrorHandler) override { return nullptr; }
+	int selectInput(Display *, Window, long) override { return requests++, 0; }
+	int sync(Display *, bool) override { return requests++, 0; }
+	int queryTree(Display *, Window, Window *, Window *, Window **, unsigned int *) override { return requests++, 0; }
+	int freeX(void *) override { return 0; }
+	int nextEvent(Display *, XEvent *) override { return 0; }
+	int pending(Display *) override { return 0; }
+	int connectionNumber(Display *) override { return -1; }
+	int refreshKeyboardMapping(XMappingEvent *) override { return 0; }
+	int killClient(Display *, XID) override { return requests++, 0; }
+	unsigned long nextRequest(Display *) override { return requests + 1; }
+	int selectScreenChanges(Display *, Window) override { return -1; }
+	int updateScreenConfiguration(XEvent *) override { return 0; }
+	int getMonitors(Display *, Window, std::vector<OutputGeometry> &outputs) override { return outputs.clear(), 0; }
+	int sendEvent(Display *, Window, bool, long, XEvent *) override { return requests++, 0; }
+	int changeProperty(Display *, Window, Atom, Atom, int, int, const unsigned char *, int) override { return requests++, 0; }
+	int getProperty(Display *, Window, Atom, long, long, bool, Atom, Atom *, int *, unsigned long *, unsigned long *, unsigned char **) override { return requests++, 0; }
+	int setInputFocus(Display *, Window, int, Time) override { return requests++, 0; }
+	int getErrorText(Display *, int, char *, int) override { return 0; }
+	int mapWindow(Display *, Window) override { return requests++, 0; }
+	int unmapWindow(Display *, Window) override { return requests++, 0; }
+	int configureWindow(Display *, Window, unsigned, XWindowChanges *) override { return requests++, 0; }
+	int setInputFocus(Display *, Window, int) override { return requests++, 0; }
+	int raiseWindow(Display *, Window) override { return requests++, 0; }
+	int lowerWindow(Display *, Window) override { return requests++, 0; }
+	int setWindowBorder(Display *, Window, unsigned long) override { return requests++, 0; }
+	int getWindowProperty(Display *, Window, Atom, long, long, bool, Atom, Atom * actual_type_return, int * actual_format_return, unsigned long * nitems_return, unsigned long *, unsigned char ** prop_return) override {
+		static unsigned char wmClass[] = "bench\0Bench";
+		requests++;
+		*actual_type_return = XA_STRING;
+		*actual_format_return = 8;
+		*nitems_return = sizeof(wmClass);
+		*prop_return = wmClass;
+		return 0;
+	}
+	int destroyWindow(Display *, Window) override { return requests++, 0; }
+	int getWindowAttributes(Display *, Window, XWindowAttributes *) override { return requests++, 0; }
+	int addToSaveSet(Display *, Window) override { return requests++, 0; }
+	int removeFromSaveSet(Display *, Window) override { return requests++, 0; }
+	int reparentWindow(Display *, Window, Window, int, int) override { return requests++, 0; }
+	int grabButton(Display *, unsigned int, unsigned int, Window, bool, unsigned int, int, int, Window, Cursor) override { return requests++, 0; }
+	int ungrabButton(Display *, unsigned int, unsigned int, Window) override { return requests++, 0; }
+	int grabKey(Display *, int, unsigned int, Window, bool, int, int) override { return requests++, 0; }
+	int ungrabKey(Display *, int, unsigned int, Window) override { return requests++, 0; }
+	int moveWindow(Display *, Window, int, int) override { return requests++, 0; }
+	int resizeWindow(Display *, Window, unsigned int, unsigned int) override { return requests++, 0; }
+	int keysymToKeycode(Display *, int) override { return 0; }
+	KeySym stringToKeysym(const char *) override { return 0; }
+	Window createWindow(Display *, Window, int, int, unsigned int, unsigned int, unsigned int, int, unsigned int, Visual *, unsigned long, XSetWindowAttributes *) override { return requests++, 0; }
+	int clearWindow(Display *, Window) override { return requests++, 0; }
+	int drawString(Display *, Window, GC, int, int, const char *, int) override { return requests++, 0; }
+	Window createSimpleWindow(Display *, Window, int, int, unsigned int, unsigned int, unsigned int, unsigned long, unsigned long) override { return requests++, 0; }
+};
@@ -133,6 +133,6 @@ std::vector<std::string> ClockWidget::registerDataKey() {
 void ClockWidget::unregisterDataKey(const std::string &key) {
 }
 
-void ClockWidget::updateData(const std::string &key, const std::string &value) {
+void ClockWidget::updateData(size_t index, const BarsDataValue &value) {
 
 }
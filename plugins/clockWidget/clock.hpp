@@ -45,7 +45,7 @@ public:
 	void setSize(int width_, int height_) override;
 	std::vector<std::string> registerDataKey() override;
 	void unregisterDataKey(const std::string& key) override;
-	void updateData(const std::string& key, const std::string& value) override;
+	void updateData(size_t index, const BarsDataValue& value) override;
 
 private:
 	Display* display;
@@ -1,6 +1,6 @@
 #include "groupw.hpp"
+#include <algorithm>
 #include <iostream>
-#include <sstream>
 GroupWidget::GroupWidget() : display(nullptr),
 							 parentWindow(0),
 							 window(0),
@@ -13,7 +13,9 @@ GroupWidget::GroupWidget() : display(nullptr),
 							 ftdraw(nullptr),
 							 fontStruct(nullptr),
 							 ftcolor(),
-							 data(){}
+							 groups(),
+							 hungGroups(),
+							 activeGroup(0){}
 
 GroupWidget::~GroupWidget() = default;
 
@@ -66,24 +68,15 @@ Window GroupWidget::initialize(Display *d,
 					   DefaultColormap(display, screen),
 					   &renderColor,
 					   &ftcolor);
-	data["Groups"] = "";
-	data["ActiveGroup"] = "";
 	return window;
 }
-std::vector<std::string> splitString(const std::string& input, char delimiter) {
-	std::vector<std::string> elements;
-	std::stringstream ss(input);
-	std::string item;
-	while (std::getline(ss, item, delimiter)) {
-		elements.push_back(item);
-	}
-	return elements;
-}
-
 void GroupWidget::draw() {
 	XClearWindow(display, window);
 	int screen = DefaultScreen(display);
-	std::vector<std::string> groups = splitString(data["Groups"], ',');
+	if (groups.empty()) {
+		XFlush(display);
+		return;
+	}
 	int groupWidth = width / groups.size();
 	XGCValues values;
 	values.foreground = XBlackPixel(display, screen);
@@ -97,11 +90,13 @@ void GroupWidget::draw() {
 //			result += " | ";
 //		}
 		result = "";
-		if (groups[i] == data["ActiveGroup"]) {
+		if (static_cast<long>(i) == activeGroup) {
 			result += "[" + groups[i] + "]";
 		} else {
 			result += " " + groups[i] + " ";
 		}
+		if (std::find(hungGroups.begin(), hungGroups.end(), groups[i]) != hungGroups.end())
+			result += " (not responding)";
 		int StartX = i * groupWidth;
 		XftDrawString8(ftdraw,
 					   &ftcolor,
@@ -150,6 +145,7 @@ std::vector<std::string> GroupWidget::registerDataKey() {
 	std::vector <std::string> keys;
 	keys.emplace_back("Groups");
 	keys.emplace_back("ActiveGroup");
+	keys.emplace_back("Hung");
 	return keys;
 }
 
@@ -157,6 +153,11 @@ void GroupWidget::unregisterDataKey(const std::string &key) {
 
 }
 
-void GroupWidget::updateData(const std::string &key, const std::string &value) {
-	data[key] = value;
+void GroupWidget::updateData(size_t index, const BarsDataValue &value) {
+	if (index == 0 && value.type == BD_STRING_LIST)
+		groups = value.list;
+	else if (index == 1 && value.type == BD_INT)
+		activeGroup = value.integer;
+	else if (index == 2 && value.type == BD_STRING_LIST)
+		hungGroups = value.list;
 }
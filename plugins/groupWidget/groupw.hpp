@@ -26,7 +26,6 @@
 #include "Bars/Widget.hpp"
 #include <string>
 #include <vector>
-#include <unordered_map>
 extern "C" {
 #include <X11/Xlib.h>
 #include <X11/Xft/Xft.h>
@@ -53,7 +52,7 @@ public:
 	void setSize(int width_, int height_) override;
 	std::vector<std::string> registerDataKey() override;
 	void unregisterDataKey(const std::string& key) override;
-	void updateData(const std::string& key, const std::string& value) override;
+	void updateData(size_t index, const BarsDataValue& value) override;
 private:
 	Display* display;
 	Window parentWindow;
@@ -68,7 +67,9 @@ private:
 	XftDraw* ftdraw;
 	XftFont* fontStruct;
 	XftColor ftcolor;
-	std::unordered_map <std::string,std::string> data;
+	std::vector<std::string> groups;
+	std::vector<std::string> hungGroups;
+	long activeGroup;
 };
 extern "C" Widget* createPlugin() {
 	return new GroupWidget();
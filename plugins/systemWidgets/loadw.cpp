@@ -0,0 +1,7 @@
+#include "sysw.hpp"
+extern "C" Widget* createPlugin() {
+	return new SystemWidget({{"LOAD", "LoadAvg", "", 100}});
+}
+extern "C" void destroyPlugin(Widget* widget) {
+	delete widget;
+}
@@ -0,0 +1,8 @@
+#include "sysw.hpp"
+extern "C" Widget* createPlugin() {
+	return new SystemWidget({{"RX", "NetRx", "KiB/s", 1},
+							 {"TX", "NetTx", "KiB/s", 1}});
+}
+extern "C" void destroyPlugin(Widget* widget) {
+	delete widget;
+}
@@ -0,0 +1,138 @@
+#include "sysw.hpp"
+#include <iostream>
+#include <cstdio>
+#include <utility>
+SystemWidget::SystemWidget(std::vector<SystemField> fields_) : display(nullptr),
+															   parentWindow(0),
+															   window(0),
+															   x(0),
+															   y(0),
+															   width(0),
+															   height(0),
+															   bgColor(0),
+															   fgColor(0),
+															   ftdraw(nullptr),
+															   fontStruct(nullptr),
+															   ftcolor(),
+															   fields(std::move(fields_)),
+															   values(fields.size(), 0),
+															   received(fields.size(), false),
+															   text() {
+	buildText();
+}
+
+SystemWidget::~SystemWidget() = default;
+
+Window SystemWidget::initialize(Display *d,
+								Window pW,
+								int x_,
+								int y_,
+								int width_,
+								int height_,
+								std::string font_,
+								unsigned long bgColor_,
+								unsigned long fgColor_,
+								int fontSize) {
+	display = d;
+	parentWindow = pW;
+	x = x_;
+	y = y_;
+	width = width_;
+	height = height_;
+	bgColor = bgColor_;
+	fgColor = fgColor_;
+	int screen = DefaultScreen(display);
+	window = XCreateSimpleWindow(display, parentWindow, x, y, width, height, 0, 0, bgColor);
+	XSetWindowBorder(display, window, 0x000000);
+	XSetWindowBorderWidth(display, window, 1);
+	XMapWindow(display, window);
+	ftdraw = XftDrawCreate(display,
+						   window,
+						   DefaultVisual(display, screen),
+						   DefaultColormap(display, screen));
+	if (!ftdraw) {
+		std::cerr << "XftDrawCreate failed" << std::endl;
+	}
+	fontName = font_ + ":size=" + std::to_string(fontSize);
+	fontStruct = XftFontOpenName(display, screen, fontName.c_str());
+	if (!fontStruct) {
+		std::cerr << "XftFontOpenName failed" << std::endl;
+	}
+	XRenderColor renderColor;
+	renderColor.red = 0;
+	renderColor.green = 0;
+	renderColor.blue = 0;
+	renderColor.alpha = 0xFFFF;
+	XftColorAllocValue(display,
+					   DefaultVisual(display, screen),
+					   DefaultColormap(display, screen),
+					   &renderColor,
+					   &ftcolor);
+	return window;
+}
+
+void SystemWidget::buildText() {
+	char field[64];
+	text.clear();
+	for (size_t i = 0; i < fields.size(); ++i) {
+		if (!text.empty())
+			text += "  ";
+		if (!received[i])
+			snprintf(field, sizeof(field), "%s --", fields[i].label);
+		else if (fields[i].divisor > 1)
+			snprintf(field, sizeof(field), "%s %ld.%02ld%s",
+					 fields[i].label,
+					 values[i] / fields[i].divisor,
+					 values[i] % fields[i].divisor,
+					 fields[i].unit);
+		else
+			snprintf(field, sizeof(field), "%s %ld%s", fields[i].label, values[i], fields[i].unit);
+		text += field;
+	}
+}
+
+void SystemWidget::draw() {
+	XClearWindow(display, window);
+	XftDrawStringUtf8(ftdraw,
+					  &ftcolor,
+					  fontStruct,
+					  10, height / 2,
+					  (const FcChar8*)text.c_str(),
+					  text.size());
+	XFlush(display);
+}
+
+void SystemWidget::handleEvent(XEvent &event) {
+
+}
+
+void SystemWidget::shutdown() {
+
+}
+
+void SystemWidget::setPosition(int x_, int y_) {
+
+}
+
+void SystemWidget::setSize(int width_, int height_) {
+
+}
+
+std::vector<std::string> SystemWidget::registerDataKey() {
+	std::vector <std::string> keys;
+	for (const auto &f : fields)
+		keys.emplace_back(f.key);
+	return keys;
+}
+
+void SystemWidget::unregisterDataKey(const std::string &key) {
+
+}
+
+void SystemWidget::updateData(size_t index, const BarsDataValue &value) {
+	if (index >= fields.size() || value.type != BD_INT)
+		return;
+	values[index] = value.integer;
+	received[index] = true;
+	buildText();
+}
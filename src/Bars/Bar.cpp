@@ -36,14 +36,9 @@ Bar::Bar() : window(0),
 			 root(0) {}
 
 Bar::~Bar() {
-//	typedef void destroy_t(Widget*);
-//	destroy_t *destroyPlugin = (destroy_t*)dlsym(handle, "destroyPlugin");
-//	if (!destroyPlugin) {
-//		std::cerr << "Cannot load symbol destroyPlugin: " << dlerror() << '\n';
-//		dlclose(handle);
-//		return;
-//	}
-//	destroyPlugin(widget);
+	for (size_t i = 0; i < widgets.size(); i++) {
+		destroyWidget(i);
+	}
 }
 
 void Bar::init(std::shared_ptr<ConfigDataBar> configData, std::shared_ptr<TSBarsData> tsData) {
@@ -96,7 +91,8 @@ void Bar::draw() {
 		return;
 	}
 	for (auto &w : widgets) {
-		w.second->draw();
+		if (w.widget)
+			w.widget->draw();
 	}
 	XFlush(display);
 }
@@ -113,18 +109,28 @@ unsigned int Bar::getSizeY() const {
 	return sizeY;
 }
 
-void Bar::addWidget(void *handle, std::shared_ptr<ConfigDataWidget> widgetConfig) {
+Widget *Bar::addWidget(void *handle, std::shared_ptr<ConfigDataWidget> widgetConfig) {
+	widgets.push_back({nullptr, 0, handle, widgetConfig});
+	return createWidget(widgets.size() - 1, handle);
+}
+
+Widget *Bar::createWidget(size_t index, void *handle) {
+	BarWidget &slot = widgets.at(index);
+	slot.handle = handle;
+	if (!handle)
+		return nullptr;
 	typedef Widget* create_t();
 	create_t* createPlugin = (create_t*)dlsym(handle, "createPlugin");
 	if (!createPlugin) {
 		std::cerr << "Cannot load symbol createPlugin: " << dlerror() << '\n';
-		return;
+		return nullptr;
 	}
 	Widget * newWidget = createPlugin();
 	if (!newWidget) {
 		Logger::GetInstance()->Log("Cannot create plugin: " + std::string(dlerror()), L_ERROR);
-		return;
+		return nullptr;
 	}
+	const auto &widgetConfig = slot.config;
 	// TODO : change position/size for left/right bar
 	Window newWidgetWindow = newWidget->initialize(display,
 										window,
@@ -141,9 +147,28 @@ void Bar::addWidget(void *handle, std::shared_ptr<ConfigDataWidget> widgetConfig
 							   + "] Bar ["
 							   + std::to_string(window)
 							   + "]", L_INFO);
-	widgets[newWidgetWindow] = newWidget;
+	slot.widget = newWidget;
+	slot.window = newWidgetWindow;
+	return newWidget;
+}
+
+void Bar::destroyWidget(size_t index) {
+	BarWidget &slot = widgets.at(index);
+	if (!slot.widget)
+		return;
+	typedef void destroy_t(Widget *);
+	destroy_t* destroyPlugin = (destroy_t*)dlsym(slot.handle, "destroyPlugin");
+	if (!destroyPlugin) {
+		Logger::GetInstance()->Log("Cannot load symbol destroyPlugin: " + std::string(dlerror()), L_ERROR);
+	} else {
+		destroyPlugin(slot.widget);
+	}
+	if (slot.window)
+		XDestroyWindow(display, slot.window);
+	slot.widget = nullptr;
+	slot.window = 0;
 }
 
-const std::unordered_map<Window, Widget *> &Bar::getWidgets() const {
+const std::vector<BarWidget> &Bar::getWidgets() const {
 	return widgets;
 }
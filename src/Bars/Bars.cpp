@@ -29,12 +29,15 @@
 #include "Config/ConfigDataWidget.hpp"
 #include "Bars/TSBarsData.hpp"
 #include "Bars/Widget.hpp"
+#include "Bars/SystemSampler.hpp"
 #include "WindowManager.hpp"
 #include <string>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
 #include <dlfcn.h>
+#include <sys/stat.h>
+#include <algorithm>
 
 Bars * Bars::instance = nullptr;
 void Bars::init(std::shared_ptr<ConfigDataBars> configData,
@@ -46,66 +49,147 @@ void Bars::init(std::shared_ptr<ConfigDataBars> configData,
 	this->display = display;
 	this->root = root;
 	for (auto &bar : this->configData->getBars()) {
-		std::unique_ptr<Bar> newBar = std::make_unique<Bar>();
-		newBar->init(bar, this->tsData);
+		std::unique_ptr<Bar> newBar = createBar(bar);
+		this->windows.push_back(newBar->getWindow());
+		this->bars.push_back(std::move(newBar));
+	}
+	computeSpaces(this->configData);
+	sampler = std::make_unique<SystemSampler>();
+	if (!sampler->init(this->tsData, [this](BarsChannel channel) {
+			return channel < subscriptions.size() && !subscriptions[channel].empty();
+		}))
+		sampler.reset();
+}
+std::unique_ptr<Bar> Bars::createBar(const std::shared_ptr<ConfigDataBar> &bar) {
+	std::unique_ptr<Bar> newBar = std::make_unique<Bar>();
+	newBar->init(bar, this->tsData);
+	for (auto &w : bar->getWidgets()) {
+		if (pluginsLocations.find(w->getPluginLocation()) == pluginsLocations.end()) {
+			addPluginLocation(w->getPluginLocation());
+			loadPlugin(w->getPluginLocation());
+		}
+		newBar->addWidget(getPluginHandle(w->getPluginLocation()), w);
+	}
+	Logger::GetInstance()->Log("Bar ["
+								+ std::to_string(this->bars.size())
+								+ "] on window ["
+								+ std::to_string(newBar->getWindow())
+								+ "] initialized\t"
+								+ bar->getBarPosition()
+								+ " "
+								+ std::to_string(newBar->getSizeX())
+								+ " x "
+								+ std::to_string(newBar->getSizeY()),L_INFO);
+	for (auto &w:newBar->getWidgets()) {
+		if (w.widget)
+			subscribeWidget(w.widget);
+	}
+	return newBar;
+}
+bool Bars::computeSpaces(const std::shared_ptr<ConfigDataBars> &config) {
+	unsigned int n = 0, s = 0, e = 0, w = 0;
+	for (auto &bar : config->getBars()) {
 		if (bar->getBarPosition() == "top") {
-			this->spaceN += bar->getBarSize();
+			n += bar->getBarSize();
 		} else if (bar->getBarPosition() == "bottom") {
-			this->spaceS += bar->getBarSize();
+			s += bar->getBarSize();
 		} else if (bar->getBarPosition() == "left") {
-			this->spaceW += bar->getBarSize();
+			w += bar->getBarSize();
 		} else if (bar->getBarPosition() == "right") {
-			this->spaceE += bar->getBarSize();
+			e += bar->getBarSize();
 		}
-		for (auto &w : bar->getWidgets()) {
-			if (pluginsLocations.find(w->getPluginLocation()) == pluginsLocations.end()) {
-				addPluginLocation(w->getPluginLocation());
-				void *handle = dlopen(w->getPluginLocation().c_str(), RTLD_LAZY);
-				if (!handle) {
-					Logger::GetInstance()->Log("Cannot open library: " + std::string(dlerror()),L_ERROR);
-					continue;
-				}
-				setWidgetTypeHandle(w->getType(), handle);
-				Logger::GetInstance()->Log("Library " + w->getPluginLocation() + " opened",L_INFO);
+	}
+	bool changed = n != spaceN || s != spaceS || e != spaceE || w != spaceW;
+	spaceN = n;
+	spaceS = s;
+	spaceE = e;
+	spaceW = w;
+	return changed;
+}
+bool Bars::reconfigure(std::shared_ptr<ConfigDataBars> config, const std::vector<size_t> &changed) {
+	bool spaces = computeSpaces(config);
+	{
+		std::lock_guard<std::mutex> lock(rebuildMutex);
+		pendingConfig = std::move(config);
+		pendingRebuild.insert(pendingRebuild.end(), changed.begin(), changed.end());
+	}
+	rebuildRequested = true;
+	if (tsData)
+		tsData->notify();
+	return spaces;
+}
+void Bars::rebuildBars() {
+	std::shared_ptr<ConfigDataBars> config;
+	std::vector<size_t> changed;
+	{
+		std::lock_guard<std::mutex> lock(rebuildMutex);
+		config = std::move(pendingConfig);
+		changed.swap(pendingRebuild);
+	}
+	if (!config)
+		return;
+	this->configData = config;
+	const auto &barsConfig = config->getBars();
+	std::sort(changed.begin(), changed.end());
+	changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+	for (size_t index : changed) {
+		if (index < bars.size()) {
+			for (auto &w : bars[index]->getWidgets()) {
+				if (w.widget)
+					unsubscribeWidget(w.widget);
 			}
-			newBar->addWidget(getWidgetTypeHandle(w->getType()), w);
+			Window old = bars[index]->getWindow();
+			bars[index].reset();
+			XDestroyWindow(display, old);
+		}
+		if (index >= barsConfig.size())
+			continue;
+		std::unique_ptr<Bar> newBar = createBar(barsConfig[index]);
+		Window window = newBar->getWindow();
+		std::lock_guard<std::mutex> lock(windowsMutex);
+		if (index < bars.size()) {
+			bars[index] = std::move(newBar);
+			windows[index] = window;
+		} else {
+			bars.push_back(std::move(newBar));
+			windows.push_back(window);
 		}
-		Logger::GetInstance()->Log("Bar ["
-									+ std::to_string(this->bars.size())
-									+ "] on window ["
-									+ std::to_string(newBar->getWindow())
-									+ "] initialized\t"
-									+ bar->getBarPosition()
-									+ " "
-									+ std::to_string(newBar->getSizeX())
-									+ " x "
-									+ std::to_string(newBar->getSizeY()),L_INFO);
-		for (auto w:newBar->getWidgets()) {
-			subscribeWidget(w.second);
+	}
+	{
+		std::lock_guard<std::mutex> lock(windowsMutex);
+		while (bars.size() > barsConfig.size()) {
+			bars.pop_back();
+			windows.pop_back();
 		}
-		this->windows.push_back(newBar->getWindow());
-		this->bars.push_back(std::move(newBar));
 	}
+	Logger::GetInstance()->Log(std::to_string(changed.size()) + " bars rebuilt",L_INFO);
+	redraw();
 }
 void Bars::start_thread() {
 	barThread = std::thread(&Bars::run, this);
+	if (sampler)
+		sampler->start_thread();
 }
 void Bars::run() {
 	while (WindowManager::getInstance()->getRunning()){
 		try {
-			if (tsData->wait()) {
+			bool updated = tsData->wait();
+			if (reloadRequested.exchange(false))
+				reloadPlugins();
+			if (rebuildRequested.exchange(false))
+				rebuildBars();
+			if (updated) {
 				// Updated Data redraw
-				std::unordered_map<std::string,std::string>updated = tsData->getData();
-				for (const auto &pair: updated) {
-					this->data[pair.first] = pair.second;
-					if (subscriptions.find(pair.first) != subscriptions.end()) {
-						for (Widget* widget : subscriptions[pair.first]) {
-							widget->updateData(pair.first, pair.second);
-							widget->draw();
-						}
+				tsData->collect(this->data, this->updatedChannels);
+				for (BarsChannel channel : updatedChannels) {
+					if (channel >= subscriptions.size())
+						continue;
+					for (const auto &sub : subscriptions[channel]) {
+						sub.first->updateData(sub.second, this->data[channel]);
+						sub.first->draw();
 					}
-					XFlush(display);
 				}
+				XFlush(display);
 				this->redraw();
 			} else {
 				// Periodic redraw
@@ -118,7 +202,8 @@ void Bars::run() {
 }
 void Bars::redraw() {
 	for (auto &bar : this->bars) {
-		bar->draw();
+		if (bar)
+			bar->draw();
 	}
 }
 Bars::Bars() : spaceN(0),
@@ -128,8 +213,12 @@ Bars::Bars() : spaceN(0),
 			   configData(nullptr),
 			   tsData(nullptr),
 			   data(),
+			   updatedChannels(),
 			   display(nullptr),
-			   root(0)
+			   root(0),
+			   sampler(nullptr),
+			   reloadRequested(false),
+			   rebuildRequested(false)
 				{}
 
 void Bars::addPluginLocation(const std::string &location) {
@@ -140,34 +229,87 @@ const std::set<std::string> &Bars::getPluginsLocations() const {
 	return pluginsLocations;
 }
 
-void *Bars::getWidgetTypeHandle(const std::string &widgetType) {
-	try {
-		void * handle = widgetTypeHandle[widgetType];
-		return handle;
-	} catch (std::out_of_range &e) {
-		Logger::GetInstance()->Log("Widget Type " + widgetType + " not found",L_ERROR);
+void *Bars::getPluginHandle(const std::string &location) {
+	auto it = pluginHandles.find(location);
+	if (it == pluginHandles.end()) {
+		Logger::GetInstance()->Log("Plugin " + location + " not loaded",L_ERROR);
 		return nullptr;
 	}
+	return it->second;
 }
 
-void Bars::setWidgetTypeHandle(const std::string &widgetType, void *handle) {
-	widgetTypeHandle[widgetType] = handle;
+void *Bars::loadPlugin(const std::string &location) {
+	struct stat st{};
+	if (stat(location.c_str(), &st) == 0)
+		pluginStamps[location] = {st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec, st.st_ino};
+	void *handle = dlopen(location.c_str(), RTLD_LAZY);
+	pluginHandles[location] = handle;
+	if (!handle) {
+		Logger::GetInstance()->Log("Cannot open library: " + std::string(dlerror()),L_ERROR);
+		return nullptr;
+	}
+	Logger::GetInstance()->Log("Library " + location + " opened",L_INFO);
+	return handle;
 }
-Bars::~Bars() {
-	for (auto &bar : bars) {
-		for (auto &w : bar->getWidgets()) {
-			typedef void (destroy_t)(Widget *);
-			destroy_t* destroy = (destroy_t*) dlsym(w.second , "destroyPlugin");
-			const char* dlsym_error = dlerror();
-			if (dlsym_error) {
-				Logger::GetInstance()->Log("Cannot load symbol destroy: " + std::string(dlerror()),L_ERROR);
-				continue;
+
+void Bars::requestReload() {
+	reloadRequested = true;
+	if (tsData)
+		tsData->notify();
+}
+
+void Bars::reloadPlugins() {
+	for (const auto &location : pluginsLocations) {
+		struct stat st{};
+		if (stat(location.c_str(), &st) != 0) {
+			Logger::GetInstance()->Log("Plugin " + location + " not found, not reloaded",L_WARNING);
+			continue;
+		}
+		std::pair<long long, unsigned long> stamp = {st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec, st.st_ino};
+		auto it = pluginStamps.find(location);
+		if (it != pluginStamps.end() && it->second == stamp && pluginHandles[location])
+			continue;
+		for (auto &bar : bars) {
+			const auto &widgets = bar->getWidgets();
+			for (size_t i = 0; i < widgets.size(); i++) {
+				if (widgets[i].config->getPluginLocation() != location || !widgets[i].widget)
+					continue;
+				unsubscribeWidget(widgets[i].widget);
+				bar->destroyWidget(i);
+			}
+		}
+		if (pluginHandles[location])
+			dlclose(pluginHandles[location]);
+		void *handle = loadPlugin(location);
+		for (auto &bar : bars) {
+			const auto &widgets = bar->getWidgets();
+			for (size_t i = 0; i < widgets.size(); i++) {
+				if (widgets[i].config->getPluginLocation() != location)
+					continue;
+				Widget *w = bar->createWidget(i, handle);
+				if (!w)
+					continue;
+				subscribeWidget(w);
+				std::vector<std::string> keys = w->registerDataKey();
+				for (size_t k = 0; k < keys.size(); k++) {
+					if (keys[k].empty())
+						continue;
+					BarsChannel channel = tsData->getChannel(keys[k]);
+					if (channel < data.size() && data[channel].type != BD_NONE)
+						w->updateData(k, data[channel]);
+				}
 			}
-			destroy(w.second);
 		}
+		Logger::GetInstance()->Log("Plugin " + location + " reloaded",L_INFO);
 	}
-	for (auto handle : widgetTypeHandle) {
-		dlclose(handle.second);
+	redraw();
+}
+
+Bars::~Bars() {
+	bars.clear();
+	for (auto handle : pluginHandles) {
+		if (handle.second)
+			dlclose(handle.second);
 	}
 }
 void Bars::createInstance() {
@@ -187,20 +329,35 @@ unsigned int Bars::getSpaceN() const { return this->spaceN; }
 unsigned int Bars::getSpaceS() const { return this->spaceS; }
 unsigned int Bars::getSpaceE() const { return this->spaceE; }
 unsigned int Bars::getSpaceW() const { return this->spaceW; }
-const std::unordered_map<std::string, std::string> &Bars::getData() const { return data; }
+const std::vector<BarsDataValue> &Bars::getData() const { return data; }
 bool Bars::isBarWindow(Window window) {
+	std::lock_guard<std::mutex> lock(windowsMutex);
 	auto it = std::find(windows.begin(), windows.end(), window);
 	return it != windows.end();
 }
 void Bars::stop_thread() {
+	if (sampler)
+		sampler->stop_thread();
 	barThread.join();
 }
 
 void Bars::subscribeWidget(Widget *w) {
 	std::vector<std::string> keys = w->registerDataKey();
-	for (const auto &key: keys) {
-		if (key.empty())
+	for (size_t i = 0; i < keys.size(); i++) {
+		if (keys[i].empty())
 			continue;
-		subscriptions[key].push_back(w);
+		BarsChannel channel = tsData->getChannel(keys[i]);
+		if (subscriptions.size() <= channel)
+			subscriptions.resize(channel + 1);
+		subscriptions[channel].emplace_back(w, i);
+	}
+}
+
+void Bars::unsubscribeWidget(Widget *w) {
+	for (auto &subscribers : subscriptions) {
+		subscribers.erase(std::remove_if(subscribers.begin(),
+										 subscribers.end(),
+										 [w](const std::pair<Widget *, size_t> &sub) { return sub.first == w; }),
+						  subscribers.end());
 	}
 }
@@ -0,0 +1,262 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Bars/SystemSampler.hpp"
+#include "Bars/TSBarsData.hpp"
+#include "WindowManager.hpp"
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstring>
+
+namespace {
+const char *sourcePaths[] = {
+		"/proc/stat",
+		"/proc/meminfo",
+		"/proc/loadavg",
+		"/proc/net/dev",
+		"/sys/class/power_supply/BAT0/capacity"
+};
+const auto sampleInterval = std::chrono::seconds(1);
+const char *skipSpaces(const char *p, const char *end) {
+	while (p < end && (*p == ' ' || *p == '\t'))
+		p++;
+	return p;
+}
+const char *nextLine(const char *p, const char *end) {
+	while (p < end && *p != '\n')
+		p++;
+	return p < end ? p + 1 : end;
+}
+unsigned long long parseNumber(const char *&p, const char *end) {
+	unsigned long long n = 0;
+	p = skipSpaces(p, end);
+	while (p < end && *p >= '0' && *p <= '9') {
+		n = n * 10 + (*p - '0');
+		p++;
+	}
+	return n;
+}
+/**
+ * @brief find the line starting with key, return a pointer after the key
+ */
+const char *findKey(const char *p, const char *end, const char *key) {
+	size_t len = std::strlen(key);
+	while (p < end) {
+		if (static_cast<size_t>(end - p) > len && std::strncmp(p, key, len) == 0)
+			return p + len;
+		p = nextLine(p, end);
+	}
+	return nullptr;
+}
+}
+
+SystemSampler::SystemSampler() : tsData(nullptr),
+								 samplerThread(),
+								 fds(),
+								 buffer(),
+								 cpuChannel(0),
+								 memChannel(0),
+								 loadChannel(0),
+								 rxChannel(0),
+								 txChannel(0),
+								 batteryChannel(0),
+								 cpuTotal(0),
+								 cpuIdle(0),
+								 rxBytes(0),
+								 txBytes(0),
+								 lastNetSample(),
+								 netPrimed(false) {
+	for (int &fd : fds)
+		fd = -1;
+}
+SystemSampler::~SystemSampler() {
+	for (int fd : fds) {
+		if (fd >= 0)
+			close(fd);
+	}
+}
+bool SystemSampler::init(std::shared_ptr<TSBarsData> data, const std::function<bool(BarsChannel)> &isSubscribed) {
+	this->tsData = data;
+	cpuChannel = tsData->getChannel("CpuUsage");
+	memChannel = tsData->getChannel("MemUsage");
+	loadChannel = tsData->getChannel("LoadAvg");
+	rxChannel = tsData->getChannel("NetRx");
+	txChannel = tsData->getChannel("NetTx");
+	batteryChannel = tsData->getChannel("Battery");
+	bool wanted[S_COUNT] = {
+			isSubscribed(cpuChannel),
+			isSubscribed(memChannel),
+			isSubscribed(loadChannel),
+			isSubscribed(rxChannel) || isSubscribed(txChannel),
+			isSubscribed(batteryChannel)
+	};
+	bool enabled = false;
+	for (int i = 0; i < S_COUNT; i++) {
+		if (!wanted[i])
+			continue;
+		fds[i] = open(sourcePaths[i], O_RDONLY | O_CLOEXEC);
+		if (fds[i] < 0) {
+			Logger::GetInstance()->Log("SystemSampler: cannot open " + std::string(sourcePaths[i]), L_WARNING);
+			continue;
+		}
+		enabled = true;
+	}
+	return enabled;
+}
+void SystemSampler::start_thread() {
+	for (int fd : fds) {
+		if (fd >= 0) {
+			samplerThread = std::thread(&SystemSampler::run, this);
+			return;
+		}
+	}
+}
+void SystemSampler::stop_thread() {
+	if (samplerThread.joinable())
+		samplerThread.join();
+}
+void SystemSampler::run() {
+	while (WindowManager::getInstance()->getRunning()) {
+		sample();
+		std::this_thread::sleep_for(sampleInterval);
+	}
+}
+void SystemSampler::sample() {
+	if (fds[S_CPU] >= 0)
+		sampleCpu();
+	if (fds[S_MEM] >= 0)
+		sampleMem();
+	if (fds[S_LOAD] >= 0)
+		sampleLoad();
+	if (fds[S_NET] >= 0)
+		sampleNet();
+	if (fds[S_BATTERY] >= 0)
+		sampleBattery();
+}
+ssize_t SystemSampler::readSource(Source source) {
+	ssize_t n = pread(fds[source], buffer, sizeof(buffer) - 1, 0);
+	if (n < 0)
+		return -1;
+	buffer[n] = '\0';
+	return n;
+}
+void SystemSampler::sampleCpu() {
+	ssize_t n = readSource(S_CPU);
+	if (n <= 0 || std::strncmp(buffer, "cpu ", 4) != 0)
+		return;
+	const char *end = buffer + n;
+	const char *p = buffer + 3;
+	unsigned long long fields[8];
+	unsigned long long total = 0;
+	for (auto &f : fields) {
+		f = parseNumber(p, end);
+		total += f;
+	}
+	unsigned long long idle = fields[3] + fields[4];
+	if (total > cpuTotal) {
+		unsigned long long dTotal = total - cpuTotal;
+		unsigned long long dIdle = idle - cpuIdle;
+		if (cpuTotal != 0)
+			tsData->publishInt(cpuChannel, static_cast<long>(100 * (dTotal - dIdle) / dTotal));
+	}
+	cpuTotal = total;
+	cpuIdle = idle;
+}
+void SystemSampler::sampleMem() {
+	ssize_t n = readSource(S_MEM);
+	if (n <= 0)
+		return;
+	const char *end = buffer + n;
+	const char *p = findKey(buffer, end, "MemTotal:");
+	if (!p)
+		return;
+	unsigned long long total = parseNumber(p, end);
+	p = findKey(p, end, "MemAvailable:");
+	if (!p || total == 0)
+		return;
+	unsigned long long available = parseNumber(p, end);
+	tsData->publishInt(memChannel, static_cast<long>(100 * (total - available) / total));
+}
+void SystemSampler::sampleLoad() {
+	ssize_t n = readSource(S_LOAD);
+	if (n <= 0)
+		return;
+	const char *end = buffer + n;
+	const char *p = buffer;
+	long load = static_cast<long>(parseNumber(p, end)) * 100;
+	if (p < end && *p == '.') {
+		p++;
+		if (p < end && *p >= '0' && *p <= '9')
+			load += (*p++ - '0') * 10;
+		if (p < end && *p >= '0' && *p <= '9')
+			load += *p - '0';
+	}
+	tsData->publishInt(loadChannel, load);
+}
+void SystemSampler::sampleNet() {
+	ssize_t n = readSource(S_NET);
+	if (n <= 0)
+		return;
+	const char *end = buffer + n;
+	// two header lines
+	const char *p = nextLine(nextLine(buffer, end), end);
+	unsigned long long rx = 0;
+	unsigned long long tx = 0;
+	while (p < end) {
+		const char *name = skipSpaces(p, end);
+		const char *colon = name;
+		while (colon < end && *colon != ':' && *colon != '\n')
+			colon++;
+		if (colon >= end || *colon != ':') {
+			p = nextLine(p, end);
+			continue;
+		}
+		if (!(colon - name == 2 && std::strncmp(name, "lo", 2) == 0)) {
+			const char *f = colon + 1;
+			unsigned long long fields[9];
+			for (auto &field : fields)
+				field = parseNumber(f, end);
+			rx += fields[0];
+			tx += fields[8];
+		}
+		p = nextLine(colon, end);
+	}
+	auto now = std::chrono::steady_clock::now();
+	auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastNetSample).count();
+	if (netPrimed && elapsed > 0 && rx >= rxBytes && tx >= txBytes) {
+		tsData->publishInt(rxChannel, static_cast<long>((rx - rxBytes) * 1000 / 1024 / elapsed));
+		tsData->publishInt(txChannel, static_cast<long>((tx - txBytes) * 1000 / 1024 / elapsed));
+	}
+	rxBytes = rx;
+	txBytes = tx;
+	lastNetSample = now;
+	netPrimed = true;
+}
+void SystemSampler::sampleBattery() {
+	ssize_t n = readSource(S_BATTERY);
+	if (n <= 0)
+		return;
+	const char *p = buffer;
+	tsData->publishInt(batteryChannel, static_cast<long>(parseNumber(p, buffer + n)));
+}
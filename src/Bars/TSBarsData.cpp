@@ -26,37 +26,60 @@
 #include <condition_variable>
 #include <mutex>
 
-TSBarsData::TSBarsData() : mutex(), cv(), data(),modifiedKeys(){}
+TSBarsData::TSBarsData() : mutex(), cv(), names(), channels(), dirtyFlags(), dirty() {}
 TSBarsData::~TSBarsData() {}
-void TSBarsData::addData(std::string key, std::string value) {
+BarsChannel TSBarsData::getChannel(const std::string &name) {
 	std::lock_guard<std::mutex> lock(mutex);
-	data[key] = value;
-	modifiedKeys.insert(key);
-	dataChanged = true;
-	cv.notify_one();
+	auto it = names.find(name);
+	if (it != names.end())
+		return it->second;
+	auto channel = static_cast<BarsChannel>(channels.size());
+	names[name] = channel;
+	channels.emplace_back();
+	dirtyFlags.push_back(false);
+	dirty.reserve(channels.size());
+	return channel;
 }
-std::unordered_map<std::string,std::string> TSBarsData::getData() {
-	std::unique_lock<std::mutex> lock(mutex);
-	std::unordered_map<std::string, std::string> modifiedData;
-	for (const auto& key : modifiedKeys) {
-		modifiedData[key] = data[key]; // Assumes key still exists. Adjust if you track removals differently.
-	}
-	modifiedKeys.clear();
-	return modifiedData;
+void TSBarsData::publishInt(BarsChannel channel, long value) {
+	std::lock_guard<std::mutex> lock(mutex);
+	BarsDataValue &v = channels.at(channel);
+	if (v.type == BD_INT && v.integer == value)
+		return;
+	v.type = BD_INT;
+	v.integer = value;
+	markDirty(channel);
 }
-void TSBarsData::removeData(std::string key) {
+void TSBarsData::publishStringList(BarsChannel channel, const std::vector<std::string> &value) {
 	std::lock_guard<std::mutex> lock(mutex);
-	if (modifiedKeys.find(key) != modifiedKeys.end()) {
-		modifiedKeys.erase(key);
+	BarsDataValue &v = channels.at(channel);
+	if (v.type == BD_STRING_LIST && v.list == value)
+		return;
+	v.type = BD_STRING_LIST;
+	v.list = value;
+	markDirty(channel);
+}
+void TSBarsData::markDirty(BarsChannel channel) {
+	if (!dirtyFlags[channel]) {
+		dirtyFlags[channel] = true;
+		dirty.push_back(channel);
 	}
-	data.erase(key);
 	dataChanged = true;
 	cv.notify_one();
 }
-void TSBarsData::modifyData(std::string key, std::string value) {
+void TSBarsData::collect(std::vector<BarsDataValue> &snapshot, std::vector<BarsChannel> &updated) {
+	std::lock_guard<std::mutex> lock(mutex);
+	if (snapshot.size() < channels.size())
+		snapshot.resize(channels.size());
+	updated.clear();
+	for (BarsChannel channel : dirty) {
+		snapshot[channel] = channels[channel];
+		dirtyFlags[channel] = false;
+		updated.push_back(channel);
+	}
+	dirty.clear();
+}
+void TSBarsData::notify() {
 	std::lock_guard<std::mutex> lock(mutex);
-	data[key] = value;
-	modifiedKeys.insert(key);
 	dataChanged = true;
 	cv.notify_one();
 }
@@ -68,4 +91,4 @@ bool TSBarsData::wait() {
 		dataChanged = false;
 		return true;
 	}
-}
\ No newline at end of file
+}
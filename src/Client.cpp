@@ -31,11 +31,16 @@
 #include "Layouts/LayoutManager.hpp"
 #include "Group.hpp"
 #include "Logger.hpp"
-#include "Config/ConfigHandler.hpp"
-#include "Config/ConfigDataBindings.hpp"
 #include "X11wrapper/baseX11Wrapper.hpp"
 #include "YggdrasilExceptions.hpp"
 
+unsigned long Client::stackCounter_ = 0;
+bool Client::restacked_ = false;
+bool Client::followMouse_ = false;
+Atom Client::wmProtocols_ = None;
+Atom Client::wmDeleteWindow_ = None;
+Atom Client::netWmPing_ = None;
+
 Client::Client(Display *display,
 			   Window root,
 			   Window window,
@@ -82,6 +87,7 @@ Client::Client(Display *display,
 		this->title_ = "Unknown";
 	}
 	wrapper->freeX(propData);
+	updateProtocols();
 }
 Client::~Client() {
 	try {
@@ -119,10 +125,8 @@ void Client::frame() {
 			border_color,
 			BG_COLOR
 			);
-	wrapper->selectInput(
-			display_,
-			this->frame_,
-			SubstructureRedirectMask | SubstructureNotifyMask | FocusChangeMask | ClientMessage);
+	selectFrameInput();
+	wrapper->selectInput(display_, window_, PropertyChangeMask);
 	wrapper->addToSaveSet(display_,window_);
 	wrapper->reparentWindow(
 			display_,
@@ -131,26 +135,21 @@ void Client::frame() {
 			0,0
 			);
 	wrapper->mapWindow(display_,frame_);
-	//   a. Move windows with alt + left button.
-	wrapper->grabButton(
-			display_,
-			Button1,
-			Mod1Mask,
-			window_,
-			false,
-			ButtonPressMask | ButtonReleaseMask | ButtonMotionMask,
-			GrabModeAsync,
-			GrabModeAsync,
-			None,
-			None);
-	try {
-		ConfigHandler::GetInstance().getConfigData<ConfigDataBindings>()->grabKeys(display_, window_);
-	} catch (const std::exception &e) {
-		Logger::GetInstance()->Log(e.what(), L_ERROR);
-	}
 	this->framed = true;
 //	this->group_->addClient(window_, this);
 }
+void Client::selectFrameInput() {
+	long mask = SubstructureRedirectMask | SubstructureNotifyMask | FocusChangeMask | ClientMessage;
+	if (followMouse_)
+		mask |= EnterWindowMask;
+	wrapper->selectInput(display_, this->frame_, mask);
+}
+void Client::setFollowMouse(bool followMouse) { followMouse_ = followMouse; }
+void Client::setProtocolAtoms(Atom protocols, Atom deleteWindow, Atom ping) {
+	wmProtocols_ = protocols;
+	wmDeleteWindow_ = deleteWindow;
+	netWmPing_ = ping;
+}
 void Client::restack() {
 	try {
 		if (this->framed) {
@@ -160,6 +159,19 @@ void Client::restack() {
 	} catch (const X11Exception &e) {
 		Logger::GetInstance()->Log(e.what(), L_ERROR);
 	}
+	stackOrder_ = ++stackCounter_;
+	restacked_ = true;
+}
+void Client::setVisible(bool visible) {
+	Window target = this->framed ? frame_ : window_;
+	try {
+		if (visible)
+			wrapper->mapWindow(display_, target);
+		else
+			wrapper->unmapWindow(display_, target);
+	} catch (const X11Exception &e) {
+		Logger::GetInstance()->Log(e.what(), L_ERROR);
+	}
 }
 void Client::unframe() {
 	if (!this->framed)
@@ -200,7 +212,116 @@ Window Client::getFrame() const {return frame_; }
 bool Client::isFramed() const {	return framed; }
 bool Client::isMapped() const { return mapped; }
 void Client::setMapped(bool m) { Client::mapped = m; }
+unsigned long Client::getStackOrder() const { return stackOrder_; }
+bool Client::takeRestacked() {
+	bool restacked = restacked_;
+	restacked_ = false;
+	return restacked;
+}
 const std::string &Client::getTitle() const { return title_; }
+bool Client::updateTitle(Atom property) {
+	Atom netWmName = wrapper->internAtom(display_, "_NET_WM_NAME", False);
+	if (property != XA_WM_NAME && property != netWmName)
+		return false;
+	std::string title;
+	if (!readTextProperty(netWmName, wrapper->internAtom(display_, "UTF8_STRING", False), title)
+		&& !readTextProperty(XA_WM_NAME, XA_STRING, title))
+		return false;
+	if (title == title_)
+		return false;
+	title_ = title;
+	return true;
+}
+void Client::updateProtocols() {
+	Atom actualType = 0;
+	int actualFormat = 0;
+	unsigned long nItems = 0, bytesAfter = 0;
+	unsigned char *propData = nullptr;
+	wrapper->getWindowProperty(display_, window_, wmProtocols_, 0, 32, False, XA_ATOM,
+							   &actualType, &actualFormat, &nItems, &bytesAfter, &propData);
+	deleteWindow_ = false;
+	ping_ = false;
+	if (actualType == XA_ATOM && actualFormat == 32 && propData != nullptr) {
+		auto atoms = reinterpret_cast<const Atom *>(propData);
+		for (unsigned long i = 0; i < nItems; i++) {
+			deleteWindow_ = deleteWindow_ || atoms[i] == wmDeleteWindow_;
+			ping_ = ping_ || atoms[i] == netWmPing_;
+		}
+	}
+	if (propData != nullptr)
+		wrapper->freeX(propData);
+	if (!ping_) {
+		pingPending_ = false;
+		hung_ = false;
+	}
+}
+void Client::sendProtocol(Atom protocol, Time timestamp) {
+	XEvent event;
+	memset(&event, 0, sizeof(event));
+	event.xclient.type = ClientMessage;
+	event.xclient.window = window_;
+	event.xclient.message_type = wmProtocols_;
+	event.xclient.format = 32;
+	event.xclient.data.l[0] = static_cast<long>(protocol);
+	event.xclient.data.l[1] = static_cast<long>(timestamp);
+	event.xclient.data.l[2] = static_cast<long>(window_);
+	try {
+		wrapper->sendEvent(display_, window_, False, NoEventMask, &event);
+	} catch (const X11Exception &e) {
+		Logger::GetInstance()->Log(e.what(), L_ERROR);
+	}
+}
+void Client::close() {
+	if (deleteWindow_) {
+		Logger::GetInstance()->Log("Closing client: " + title_, L_INFO);
+		sendProtocol(wmDeleteWindow_, CurrentTime);
+	} else {
+		Logger::GetInstance()->Log("Killing client: " + title_, L_INFO);
+		wrapper->killClient(display_, window_);
+	}
+	wrapper->flush(display_);
+}
+bool Client::pingTick(Time timestamp) {
+	if (!ping_)
+		return false;
+	if (pingPending_) {
+		if (hung_)
+			return false;
+		Logger::GetInstance()->Log("Client not responding: " + title_, L_WARNING);
+		hung_ = true;
+		return true;
+	}
+	sendProtocol(netWmPing_, timestamp);
+	pingPending_ = true;
+	pingTimestamp_ = timestamp;
+	return false;
+}
+bool Client::pong(Time timestamp) {
+	if (!pingPending_ || timestamp != pingTimestamp_)
+		return false;
+	bool wasHung = hung_;
+	pingPending_ = false;
+	hung_ = false;
+	return wasHung;
+}
+bool Client::isHung() const { return hung_; }
+void Client::setFullscreen(bool fullscreen) { fullscreen_ = fullscreen; }
+bool Client::isFullscreen() const { return fullscreen_; }
+bool Client::supportsPing() const { return ping_; }
+bool Client::readTextProperty(Atom property, Atom type, std::string &value) {
+	Atom actualType = 0;
+	int actualFormat = 0;
+	unsigned long nItems = 0, bytesAfter = 0;
+	unsigned char *propData = nullptr;
+	wrapper->getWindowProperty(display_, window_, property, 0, 1024, False, type,
+							   &actualType, &actualFormat, &nItems, &bytesAfter, &propData);
+	bool found = actualType == type && actualFormat == 8 && propData != nullptr && nItems > 0;
+	if (found)
+		value.assign(reinterpret_cast<char *>(propData), nItems);
+	if (propData != nullptr)
+		wrapper->freeX(propData);
+	return found;
+}
 const std::string &Client::getClass() const { return class_; }
 std::shared_ptr<Group>Client::getGroup() const { return group_.lock(); }
 void Client::setGroup(std::shared_ptr<Group> g) { this->group_ = std::weak_ptr<Group>(g);}
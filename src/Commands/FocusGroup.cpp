@@ -29,26 +29,28 @@
 #include "WindowManager.hpp"
 #include "Group.hpp"
 #include "Logger.hpp"
+#include <algorithm>
 
-FocusGroup::FocusGroup() {
+FocusGroup::FocusGroup() : index_(0) {
 
 }
 
-void FocusGroup::execute(const std::string &args) {
-	int index;
+void FocusGroup::prepare(const std::string &args) {
 	try {
-		index = std::stoi(args) - 1;
+		index_ = std::stoi(args) - 1;
 	} catch ( const std::exception &e) {
 		Logger::GetInstance()->Log("Focus Group argument is not convertible to int",L_ERROR);
+		index_ = 0;
 	}
+	if (index_ < 0)
+		index_ = 0;
+}
+
+void FocusGroup::execute(const CommandContext &context) {
+	(void)context;
 	WindowManager *wm = WindowManager::getInstance();
-	if (index < 0)
-		index = 0;
-	if (index > wm->getGroups().size())
-		index = wm->getGroups().size();
-	if (wm->getActiveGroup() != wm->getGroups()[index]) {
-		wm->getActiveGroup()->switchFrom();
-		wm->getGroups()[index]->switchTo();
-	}
+	if (wm->getGroups().empty())
+		return;
+	wm->switchToGroup(std::min(static_cast<size_t>(index_), wm->getGroups().size() - 1));
 }
 
@@ -0,0 +1,74 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file FocusNext.cpp
+ * @brief FocusNext class implementation.
+ * @date 2026-10-19
+ */
+
+#include "Commands/FocusNext.hpp"
+#include "WindowManager.hpp"
+#include "Group.hpp"
+#include "Layouts/MaxLayoutManager.hpp"
+#include "Logger.hpp"
+#include <map>
+
+FocusNext::FocusNext() : step_(1) {
+
+}
+
+void FocusNext::prepare(const std::string &args) {
+	try {
+		step_ = std::stoi(args);
+	} catch (const std::exception &e) {
+		Logger::GetInstance()->Log("FocusNext argument is not convertible to int", L_ERROR);
+		step_ = 1;
+	}
+}
+
+void FocusNext::execute(const CommandContext &context) {
+	(void)context;
+	WindowManager *wm = WindowManager::getInstance();
+	auto group = wm->getActiveGroup();
+	Client *next = nullptr;
+	auto mlm = dynamic_cast<MaxLayoutManager *>(group->getLayoutManager().get());
+	if (mlm) {
+		next = mlm->nextClient(step_);
+	} else {
+		std::map<Window, Client *> ordered;
+		for (auto &client : group->getClients())
+			if (client.second)
+				ordered[client.first] = client.second.get();
+		if (ordered.empty())
+			return;
+		std::vector<Client *> clients;
+		for (auto &client : ordered)
+			clients.push_back(client.second);
+		auto count = static_cast<long>(clients.size());
+		long index = 0;
+		for (long i = 0; i < count; i++)
+			if (clients[i]->getWindow() == wm->getActiveWindow())
+				index = i;
+		next = clients[((index + step_) % count + count) % count];
+	}
+	wm->setFocus(next);
+}
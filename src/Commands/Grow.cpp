@@ -27,50 +27,37 @@
 #include "Commands/Grow.hpp"
 #include "WindowManager.hpp"
 #include "Group.hpp"
+#include "Layouts/MasterLayoutManager.hpp"
 #include "Logger.hpp"
 
 
-Grow::Grow() {
+Grow::Grow() : inc_(0) {
 
 }
 
-void Grow::execute(const std::string &args) {
-	WindowManager *wm = WindowManager::getInstance();
-	DeserializedXKeyEvent event = deserializeXKeyEvent(args);
-	std::shared_ptr<Client> client = wm->getClient(event.subwindow);
-	if (client) {
-		LayoutManager * lm = wm->getActiveGroup()->getLayoutManager().get();
-		TreeLayoutManager * tlm = dynamic_cast<TreeLayoutManager *>(lm);
-		if (tlm) {
-			tlm->growSpace(client.get(), event.inc);
-		}
+void Grow::prepare(const std::string &args) {
+	try {
+		inc_ = std::stoi(args);
+	} catch (const std::exception &e) {
+		Logger::GetInstance()->Log("Grow argument is not convertible to int", L_ERROR);
+		inc_ = 0;
 	}
 }
 
-DeserializedXKeyEvent Grow::deserializeXKeyEvent(const std::string &serializedEvent) {
-	DeserializedXKeyEvent event;
-	std::istringstream ss(serializedEvent);
-	std::string item;
-
-	// Extract args_
-	std::getline(ss, item, ',');
-	event.inc = std::stoi(item);
-
-	// Extract subwindow
-	std::getline(ss, item, ',');
-	event.subwindow = static_cast<Window>(std::stoul(item));
-
-	// Extract window
-	std::getline(ss, item, ',');
-	event.window = static_cast<Window>(std::stoul(item));
-
-	// Extract state
-	std::getline(ss, item, ',');
-	event.state = std::stoul(item);
-
-	// Extract keycode
-	std::getline(ss, item, ',');
-	event.keycode = std::stoul(item);
-
-	return event;
+void Grow::execute(const CommandContext &context) {
+	auto group = context.target != nullptr ? context.target->getGroup()
+										   : WindowManager::getInstance()->getActiveGroup();
+	if (!group)
+		return;
+	LayoutManager * lm = group->getLayoutManager().get();
+	TreeLayoutManager * tlm = dynamic_cast<TreeLayoutManager *>(lm);
+	if (tlm && context.target != nullptr) {
+		tlm->growSpace(context.target, inc_);
+	}
+	MasterLayoutManager * mlm = dynamic_cast<MasterLayoutManager *>(lm);
+	if (mlm) {
+		mlm->growMaster(inc_);
+	}
 }
+
+int Grow::getInc() const { return inc_; }
@@ -27,8 +27,8 @@
 #include "Commands/Quit.hpp"
 #include "WindowManager.hpp"
 
-void Quit::execute(const std::string &args) {
-	(void)args;
+void Quit::execute(const CommandContext &context) {
+	(void)context;
 	WindowManager::getInstance()->Stop();
 }
 
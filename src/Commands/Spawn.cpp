@@ -26,43 +26,111 @@
  */
 
 #include "Commands/Spawn.hpp"
-#include <unistd.h>
-#include <sys/wait.h>
-#include <stdexcept>
+#include <spawn.h>
+#include <csignal>
 #include <cstring>
-#include <vector>
+#include <sys/signalfd.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #include "Logger.hpp"
 
+extern char **environ;
+
+std::unordered_map<pid_t, std::string> Spawn::children_;
+
 Spawn::Spawn() = default;
-void Spawn::execute(const std::string &args) {
-	std::istringstream iss(args);
-	std::string command;
-	iss >> command;
-	std::vector<const char*> argv;
-	argv.push_back(command.c_str());
-	std::string arg;
-	while (iss >> arg) {
-		argv.push_back(arg.c_str());
-	}
-	argv.push_back(nullptr);
-	pid_t pid = fork();
-	if (pid < 0) {
-		throw std::runtime_error("Fork failed: " + std::string(strerror(errno)));
-	} else if (pid == 0) {
-		pid_t pid_inner = fork();
-		if (pid_inner < 0) {
-			exit(EXIT_FAILURE);
-		} else if (pid_inner == 0) {
-			execvp(command.c_str(), const_cast<char* const*>(argv.data()));
-			Logger::GetInstance()->Log("Failed to execute command \""
-										+ command
-										+ "\": "
-										+ strerror(errno),L_ERROR);
-			exit(EXIT_FAILURE);
+void Spawn::prepare(const std::string &args) {
+	argv_.clear();
+	std::string word;
+	bool inWord = false;
+	char quote = 0;
+	for (char c : args) {
+		if (quote != 0) {
+			if (c == quote)
+				quote = 0;
+			else
+				word += c;
+		} else if (c == '"' || c == '\'') {
+			quote = c;
+			inWord = true;
+		} else if (c == ' ' || c == '\t') {
+			if (inWord)
+				argv_.push_back(word);
+			word.clear();
+			inWord = false;
+		} else {
+			word += c;
+			inWord = true;
 		}
-		exit(EXIT_SUCCESS);
-	} else {
-		waitpid(pid, nullptr, 0);
 	}
-	Logger::GetInstance()->Log("Succefully launched " + args,L_INFO);
-}
\ No newline at end of file
+	if (inWord)
+		argv_.push_back(word);
+	argvPtrs_.clear();
+	for (auto &arg : argv_)
+		argvPtrs_.push_back(&arg[0]);
+	argvPtrs_.push_back(nullptr);
+}
+void Spawn::execute(const CommandContext &context) {
+	(void)context;
+	if (argv_.empty()) {
+		Logger::GetInstance()->Log("Spawn: no command to launch", L_ERROR);
+		return;
+	}
+	posix_spawnattr_t attr;
+	posix_spawnattr_init(&attr);
+	sigset_t mask;
+	sigemptyset(&mask);
+	posix_spawnattr_setsigmask(&attr, &mask);
+	sigset_t defaults;
+	sigemptyset(&defaults);
+	sigaddset(&defaults, SIGCHLD);
+	sigaddset(&defaults, SIGINT);
+	sigaddset(&defaults, SIGPIPE);
+	posix_spawnattr_setsigdefault(&attr, &defaults);
+	short flags = POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETSIGDEF;
+#ifdef POSIX_SPAWN_SETSID
+	flags |= POSIX_SPAWN_SETSID;
+#endif
+	posix_spawnattr_setflags(&attr, flags);
+	pid_t pid;
+	int err = posix_spawnp(&pid, argvPtrs_[0], nullptr, &attr, argvPtrs_.data(), environ);
+	posix_spawnattr_destroy(&attr);
+	if (err != 0) {
+		Logger::GetInstance()->Log("Failed to execute command \""
+									+ argv_[0]
+									+ "\": "
+									+ strerror(err),L_ERROR);
+		return;
+	}
+	children_[pid] = argv_[0];
+	Logger::GetInstance()->Log("Succefully launched " + argv_[0] + " [" + std::to_string(pid) + "]",L_INFO);
+}
+const std::vector<std::string> &Spawn::getArgv() const { return argv_; }
+int Spawn::openChildSignalFd() {
+	sigset_t mask;
+	sigemptyset(&mask);
+	sigaddset(&mask, SIGCHLD);
+	if (pthread_sigmask(SIG_BLOCK, &mask, nullptr) != 0)
+		return -1;
+	int fd = signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+	if (fd < 0)
+		Logger::GetInstance()->Log("signalfd failed: " + std::string(strerror(errno)), L_ERROR);
+	return fd;
+}
+void Spawn::reapChildren(int fd) {
+	signalfd_siginfo info;
+	while (read(fd, &info, sizeof(info)) == sizeof(info))
+		;
+	int status;
+	pid_t pid;
+	while ((pid = waitpid(-1, &status, WNOHANG)) > 0) {
+		auto it = children_.find(pid);
+		if (it == children_.end())
+			continue;
+		if (WIFEXITED(status) && WEXITSTATUS(status) != 0)
+			Logger::GetInstance()->Log(it->second + " [" + std::to_string(pid) + "] exited with status "
+										+ std::to_string(WEXITSTATUS(status)), L_WARNING);
+		children_.erase(it);
+	}
+}
+size_t Spawn::getChildCount() { return children_.size(); }
@@ -31,6 +31,10 @@
 #include "Commands/Spawn.hpp"
 #include "Commands/Quit.hpp"
 #include "Commands/Grow.hpp"
+#include "Commands/ReloadWidgets.hpp"
+#include "Commands/FocusNext.hpp"
+#include "Commands/Mode.hpp"
+#include "Commands/Close.hpp"
 #include "WindowManager.hpp"
 #include "X11wrapper/baseX11Wrapper.hpp"
 extern "C" {
@@ -43,34 +47,59 @@ void Binding::init(std::string Mod, std::string Key, std::string Command, std::s
 	key_ = Key;
 	commandName_ = Command;
 	args_ = Args;
-	if (commandName_ == "FocusGroup") {
-		command_ = new FocusGroup();
-	} else if (commandName_ == "Spawn") {
-		command_ = new Spawn();
-	} else if (commandName_== "Quit") {
-		command_ = new Quit();
-	} else if (commandName_ == "Grow") {
-		 command_ = new Grow();
-	} else {
-		throw std::runtime_error("Unknown command: " + commandName_);
-	}
-	if (mod_ == "Mod4") {
-		modMask_ = Mod4Mask;
-	} else if (mod_ == "Mod1") {
-		modMask_ = Mod1Mask;
-	} else {
-		throw std::runtime_error("Unknown mod : " + mod_);
+	command_ = createCommand(commandName_);
+	command_->prepare(args_);
+	modMask_ = parseModMask(mod_);
+}
+CommandBase *Binding::createCommand(const std::string &name) {
+	if (name == "FocusGroup") {
+		return new FocusGroup();
+	} else if (name == "Spawn") {
+		return new Spawn();
+	} else if (name == "Quit") {
+		return new Quit();
+	} else if (name == "Grow") {
+		return new Grow();
+	} else if (name == "ReloadWidgets") {
+		return new ReloadWidgets();
+	} else if (name == "FocusNext") {
+		return new FocusNext();
+	} else if (name == "Mode") {
+		return new Mode();
+	} else if (name == "Close") {
+		return new Close();
 	}
+	throw std::runtime_error("Unknown command: " + name);
 }
-void Binding::execute(const XKeyEvent *event = nullptr) {
-	if (command_ != nullptr) {
-		if (event == nullptr) {
-			command_->execute(args_);
+unsigned int Binding::parseModMask(const std::string &mod) {
+	unsigned int mask = 0;
+	size_t start = 0;
+	while (start < mod.size()) {
+		size_t end = mod.find('+', start);
+		if (end == std::string::npos)
+			end = mod.size();
+		std::string name = mod.substr(start, end - start);
+		if (name == "Mod4") {
+			mask |= Mod4Mask;
+		} else if (name == "Mod1") {
+			mask |= Mod1Mask;
+		} else if (name == "Shift") {
+			mask |= ShiftMask;
+		} else if (name == "Control") {
+			mask |= ControlMask;
 		} else {
-			std::stringstream ss;
-			ss << args_ << "," <<event->subwindow << "," << event->window << "," << event->state << "," << event->keycode;
-			command_->execute(ss.str());
+			throw std::runtime_error("Unknown mod : " + mod);
 		}
+		start = end + 1;
+	}
+	return mask;
+}
+void Binding::execute(const XKeyEvent *event, Client *target) {
+	if (command_ != nullptr) {
+		CommandContext context;
+		context.event = event;
+		context.target = target;
+		command_->execute(context);
 	}
 	else
 		throw std::runtime_error("Command not initialized.");
@@ -27,23 +27,96 @@
 
 #include "Config/ConfigDataBindings.hpp"
 #include "Logger.hpp"
+#include <stdexcept>
+#include <algorithm>
+#include <iterator>
+#include "X11wrapper/baseX11Wrapper.hpp"
+extern "C" {
+#include <X11/keysym.h>
+}
 
-ConfigDataBindings::ConfigDataBindings() : bindings_(){}
+ConfigDataBindings::ConfigDataBindings() :
+	bindings_(),
+	sequences_(),
+	nodes_(),
+	modes_(),
+	modifierKeycodes_(),
+	numLockMask_(Mod2Mask),
+	escapeKeycode_(0),
+	current_(0),
+	modeRoot_(0),
+	activeMode_(),
+	keyboardGrabbed_(false),
+	focusFollowsMouse_(false),
+	display_(nullptr) {}
 void ConfigDataBindings::configInit(const Json::Value &root) {
 	std::vector<std::string> modKeys = root.getMemberNames();
 	for (auto &modKey : modKeys) {
+		if (modKey == "FocusFollowsMouse") {
+			focusFollowsMouse_ = root[modKey].asBool();
+			continue;
+		}
+		if (modKey == "Modes") {
+			for (auto &modeName : root[modKey].getMemberNames()) {
+				for (auto &binding : root[modKey][modeName])
+					addBinding("", {binding["Key"].asString()}, modeName, binding);
+			}
+			continue;
+		}
+		if (modKey == "Chords") {
+			for (auto &binding : root[modKey]) {
+				std::vector<std::string> keys;
+				for (auto &key : binding["Keys"])
+					keys.push_back(key.asString());
+				addBinding("", keys, "", binding);
+			}
+			continue;
+		}
 		Json::Value bindings = root[modKey];
 		for (auto &binding : bindings) {
-			std::string key = binding["Key"].asString();
-			std::string command = binding["Action"].asString();
-			std::string arg = binding["Argument"].asString();
-			auto b = new Binding();
-			b->init(modKey, key, command, arg);
-			bindings_.push_back(b);
+			addBinding(modKey, {binding["Key"].asString()}, "", binding);
 		}
 	}
 	Logger::GetInstance()->Log("Successfully added " + std::to_string(bindings_.size()) + " bindings", L_INFO);
 }
+void ConfigDataBindings::addBinding(const std::string &mod,
+									const std::vector<std::string> &keys,
+									const std::string &mode,
+									const Json::Value &binding) {
+	if (keys.empty())
+		throw std::runtime_error("Binding without key");
+	KeySequence sequence;
+	sequence.mode = mode;
+	for (auto &key : keys)
+		sequence.strokes.push_back(parseStroke(key));
+	sequence.strokes[0].mask |= Binding::parseModMask(mod);
+	std::string last = keys.back();
+	size_t split = last.rfind('+');
+	std::string lastMod = mod;
+	if (split != std::string::npos && split > 0) {
+		lastMod = last.substr(0, split);
+		last = last.substr(split + 1);
+	}
+	auto b = new Binding();
+	try {
+		b->init(lastMod, last, binding["Action"].asString(), binding["Argument"].asString());
+	} catch (...) {
+		delete b;
+		throw;
+	}
+	bindings_.push_back(b);
+	sequence.binding = b;
+	sequences_.push_back(sequence);
+}
+KeyStroke ConfigDataBindings::parseStroke(const std::string &stroke) {
+	KeyStroke result{stroke, 0, 0};
+	size_t split = stroke.rfind('+');
+	if (split != std::string::npos && split > 0) {
+		result.mask = Binding::parseModMask(stroke.substr(0, split));
+		result.key = stroke.substr(split + 1);
+	}
+	return result;
+}
 Json::Value ConfigDataBindings::configSave() {
 	return Json::Value();
 }
@@ -54,40 +127,273 @@ ConfigDataBindings::~ConfigDataBindings() {
 }
 
 void ConfigDataBindings::grabKeys(Display *display, Window window) {
-	for (auto &binding : bindings_) {
-		XGrabKey(display, binding->getKeyCode(), binding->getModMask(), window, true, GrabModeAsync, GrabModeAsync);
+	if (nodes_.empty())
+		return;
+	const unsigned int locks[] = {0, LockMask, numLockMask_, LockMask | numLockMask_};
+	for (auto &edge : nodes_[0].next) {
+		auto keycode = static_cast<int>(edge.first >> 32);
+		auto mask = static_cast<unsigned int>(edge.first & 0xffffffff);
+		for (unsigned int lock : locks)
+			XGrabKey(display, keycode, mask | lock, window, true, GrabModeAsync, GrabModeAsync);
 	}
 	XFlush(display);
 }
 
-void ConfigDataBindings::handleKeypressEvent(const XKeyEvent *event) {
-	unsigned int keyCode = event->keycode;
-	bool modOk = false;
-	for (auto &binding : bindings_) {
-		modOk = event->state & binding->getModMask();
-		if (binding->getKeyCode() == keyCode && modOk) {
-			if (binding->getCommandName() == "Grow") {
-				binding->execute(event);
-			} else {
-				binding->execute(nullptr);
-			}
-			Logger::GetInstance()->Log("[" +
-										binding->getMod()
-										+ "+"
-										+ binding->getKey()
-										+"] ->\t"
-										+ binding->getCommandName()
-										+ " ["
-										+ binding->getArgs()
-										+ "]",L_INFO);
-		}
+void ConfigDataBindings::handleKeypressEvent(const XKeyEvent *event, Client *target) {
+	if (nodes_.empty())
+		return;
+	if (event->keycode < modifierKeycodes_.size() && modifierKeycodes_[event->keycode])
+		return;
+	auto &next = nodes_[current_].next;
+	auto it = next.find(tableKey(event->keycode, cleanMask(event->state)));
+	if (it == next.end()) {
+		if (current_ != modeRoot_)
+			moveTo(modeRoot_);
+		else if (modeRoot_ != 0 && static_cast<int>(event->keycode) == escapeKeycode_)
+			enterMode("");
+		return;
+	}
+	uint32_t child = it->second;
+	Binding *binding = nodes_[child].binding;
+	if (binding == nullptr) {
+		moveTo(child);
+		return;
 	}
+	moveTo(modeRoot_);
+	binding->execute(event, target);
+	Logger::GetInstance()->Log("[" +
+								binding->getMod()
+								+ "+"
+								+ binding->getKey()
+								+"] ->\t"
+								+ binding->getCommandName()
+								+ " ["
+								+ binding->getArgs()
+								+ "]",L_INFO);
 }
 
+Binding *ConfigDataBindings::findBinding(unsigned int keycode, unsigned int state) const {
+	if (nodes_.empty())
+		return nullptr;
+	auto it = nodes_[0].next.find(tableKey(keycode, cleanMask(state)));
+	if (it == nodes_[0].next.end())
+		return nullptr;
+	return nodes_[it->second].binding;
+}
+
+unsigned int ConfigDataBindings::cleanMask(unsigned int state) const {
+	return state & ~(numLockMask_ | LockMask)
+		   & (ShiftMask | ControlMask | Mod1Mask | Mod2Mask | Mod3Mask | Mod4Mask | Mod5Mask);
+}
+
+unsigned int ConfigDataBindings::getNumLockMask() const { return numLockMask_; }
+
+uint64_t ConfigDataBindings::tableKey(unsigned int keycode, unsigned int mask) {
+	return (static_cast<uint64_t>(keycode) << 32) | mask;
+}
+
+void ConfigDataBindings::enterMode(const std::string &name) {
+	auto it = modes_.find(name);
+	if (name.empty() || it == modes_.end()) {
+		if (!name.empty())
+			Logger::GetInstance()->Log("Unknown mode: " + name, L_WARNING);
+		activeMode_.clear();
+		modeRoot_ = 0;
+	} else {
+		activeMode_ = name;
+		modeRoot_ = it->second;
+	}
+	moveTo(modeRoot_);
+}
+
+void ConfigDataBindings::moveTo(uint32_t node) {
+	current_ = node;
+	bool grab = node != 0;
+	if (grab == keyboardGrabbed_)
+		return;
+	if (display_ != nullptr) {
+		if (grab)
+			XGrabKeyboard(display_, DefaultRootWindow(display_), True, GrabModeAsync, GrabModeAsync, CurrentTime);
+		else
+			XUngrabKeyboard(display_, CurrentTime);
+	}
+	keyboardGrabbed_ = grab;
+}
+
+const std::string &ConfigDataBindings::getActiveMode() const { return activeMode_; }
+bool ConfigDataBindings::isKeyboardGrabbed() const { return keyboardGrabbed_; }
+bool ConfigDataBindings::getFocusFollowsMouse() const { return focusFollowsMouse_; }
+
 void ConfigDataBindings::initKeycodes(Display *display, BaseX11Wrapper *x11Wrapper) {
+	display_ = display;
+	readModifierMapping();
+	escapeKeycode_ = resolveKeycode(display, x11Wrapper, XK_Escape);
 	for (auto &binding : bindings_) {
 		binding->init_keycode(display,x11Wrapper);
 	}
+	for (auto &sequence : sequences_) {
+		for (auto &stroke : sequence.strokes)
+			stroke.keycode = resolveKeycode(display, x11Wrapper, x11Wrapper->stringToKeysym(stroke.key.c_str()));
+	}
+	compileTrie();
+}
+
+size_t ConfigDataBindings::refreshKeycodes(Display *display, BaseX11Wrapper *x11Wrapper, const std::vector<Window> &windows) {
+	display_ = display;
+	unsigned int oldNumLock = numLockMask_;
+	readModifierMapping();
+	escapeKeycode_ = resolveKeycode(display, x11Wrapper, XK_Escape);
+	size_t changed = 0;
+	for (auto &sequence : sequences_) {
+		bool sequenceChanged = false;
+		for (auto &stroke : sequence.strokes) {
+			int keycode = resolveKeycode(display, x11Wrapper, x11Wrapper->stringToKeysym(stroke.key.c_str()));
+			if (keycode != stroke.keycode) {
+				stroke.keycode = keycode;
+				sequenceChanged = true;
+			}
+		}
+		if (!sequenceChanged)
+			continue;
+		changed++;
+		try {
+			sequence.binding->init_keycode(display, x11Wrapper);
+		} catch (const std::exception &e) {
+			Logger::GetInstance()->Log(e.what(), L_WARNING);
+		}
+	}
+	if (changed == 0 && oldNumLock == numLockMask_) {
+		Logger::GetInstance()->Log("Keyboard mapping changed, bindings unchanged", L_INFO);
+		return 0;
+	}
+	std::vector<uint64_t> before = rootEdges();
+	compileTrie();
+	replaceGrabs(before, oldNumLock, display, x11Wrapper, windows);
+	Logger::GetInstance()->Log("Keyboard mapping changed, " + std::to_string(changed) + " bindings updated", L_INFO);
+	return changed;
+}
+
+void ConfigDataBindings::replaceGrabs(const ConfigDataBindings &previous, Display *display, BaseX11Wrapper *x11Wrapper,
+									  const std::vector<Window> &windows) {
+	if (previous.keyboardGrabbed_ && display != nullptr)
+		XUngrabKeyboard(display, CurrentTime);
+	replaceGrabs(previous.rootEdges(), previous.numLockMask_, display, x11Wrapper, windows);
+}
+
+void ConfigDataBindings::replaceGrabs(const std::vector<uint64_t> &before, unsigned int oldNumLock, Display *display,
+									  BaseX11Wrapper *x11Wrapper, const std::vector<Window> &windows) const {
+	std::vector<uint64_t> after = rootEdges();
+	std::vector<uint64_t> removed;
+	std::vector<uint64_t> added;
+	if (oldNumLock != numLockMask_) {
+		removed = before;
+		added = after;
+	} else {
+		std::set_difference(before.begin(), before.end(), after.begin(), after.end(), std::back_inserter(removed));
+		std::set_difference(after.begin(), after.end(), before.begin(), before.end(), std::back_inserter(added));
+	}
+	const unsigned int oldLocks[] = {0, LockMask, oldNumLock, LockMask | oldNumLock};
+	const unsigned int locks[] = {0, LockMask, numLockMask_, LockMask | numLockMask_};
+	for (Window window : windows) {
+		for (uint64_t edge : removed) {
+			for (unsigned int lock : oldLocks)
+				x11Wrapper->ungrabKey(display, static_cast<int>(edge >> 32),
+									  static_cast<unsigned int>(edge & 0xffffffff) | lock, window);
+		}
+		for (uint64_t edge : added) {
+			for (unsigned int lock : locks)
+				x11Wrapper->grabKey(display, static_cast<int>(edge >> 32),
+									static_cast<unsigned int>(edge & 0xffffffff) | lock, window,
+									true, GrabModeAsync, GrabModeAsync);
+		}
+	}
+	Logger::GetInstance()->Log(std::to_string(removed.size()) + " key grabs removed, "
+							   + std::to_string(added.size()) + " key grabs added", L_INFO);
+}
+
+int ConfigDataBindings::resolveKeycode(Display *display, BaseX11Wrapper *x11Wrapper, KeySym keysym) {
+	try {
+		return x11Wrapper->keysymToKeycode(display, static_cast<int>(keysym));
+	} catch (const std::exception &e) {
+		return 0;
+	}
+}
+
+void ConfigDataBindings::readModifierMapping() {
+	modifierKeycodes_.assign(256, false);
+	if (display_ == nullptr)
+		return;
+	XModifierKeymap *modmap = XGetModifierMapping(display_);
+	if (modmap == nullptr)
+		return;
+	KeyCode numLock = XKeysymToKeycode(display_, XK_Num_Lock);
+	for (int mod = 0; mod < 8; mod++) {
+		for (int k = 0; k < modmap->max_keypermod; k++) {
+			KeyCode code = modmap->modifiermap[mod * modmap->max_keypermod + k];
+			if (code == 0)
+				continue;
+			modifierKeycodes_[code] = true;
+			if (code == numLock)
+				numLockMask_ = 1u << mod;
+		}
+	}
+	XFreeModifiermap(modmap);
+}
+
+std::vector<uint64_t> ConfigDataBindings::rootEdges() const {
+	std::vector<uint64_t> edges;
+	if (nodes_.empty())
+		return edges;
+	for (auto &edge : nodes_[0].next)
+		edges.push_back(edge.first);
+	std::sort(edges.begin(), edges.end());
+	return edges;
+}
+
+void ConfigDataBindings::compileTrie() {
+	nodes_.clear();
+	modes_.clear();
+	nodes_.emplace_back();
+	for (auto &sequence : sequences_) {
+		if (sequence.mode.empty() || modes_.count(sequence.mode))
+			continue;
+		modes_[sequence.mode] = static_cast<uint32_t>(nodes_.size());
+		nodes_.emplace_back();
+	}
+	for (auto &sequence : sequences_) {
+		uint32_t node = sequence.mode.empty() ? 0 : modes_[sequence.mode];
+		bool valid = true;
+		for (auto &stroke : sequence.strokes) {
+			if (stroke.keycode == 0 || nodes_[node].binding != nullptr) {
+				valid = false;
+				break;
+			}
+			uint64_t key = tableKey(stroke.keycode, cleanMask(stroke.mask));
+			auto it = nodes_[node].next.find(key);
+			if (it != nodes_[node].next.end()) {
+				node = it->second;
+				continue;
+			}
+			auto child = static_cast<uint32_t>(nodes_.size());
+			nodes_.emplace_back();
+			nodes_[node].next.emplace(key, child);
+			node = child;
+		}
+		if (!valid || nodes_[node].binding != nullptr || !nodes_[node].next.empty()) {
+			Logger::GetInstance()->Log("Binding [" + sequence.binding->getMod() + "+" + sequence.binding->getKey()
+									   + "] is already bound or has an unknown key, ignored", L_WARNING);
+			continue;
+		}
+		nodes_[node].binding = sequence.binding;
+	}
+	auto mode = modes_.find(activeMode_);
+	if (mode == modes_.end()) {
+		activeMode_.clear();
+		modeRoot_ = 0;
+	} else {
+		modeRoot_ = mode->second;
+	}
+	moveTo(modeRoot_);
 }
 
 const std::vector<Binding *> &ConfigDataBindings::getBindings() const {
@@ -27,20 +27,22 @@
  */
 #include "Config/ConfigFileHandler.hpp"
 #include "Logger.hpp"
+#include <sys/inotify.h>
+#include <unistd.h>
 const std::vector<std::string> ConfigFileHandler::defaultPaths = {
 		"config.json",
 		"$HOME/.config/YggdrasilWM/config.json",
 		"$HOME/.YggdrasilWM/config.json",
 		"/etc/YggdrasilWM/config.json"
 };
-ConfigFileHandler::ConfigFileHandler() : configPath_(""),root_() {
+ConfigFileHandler::ConfigFileHandler() : configPath_(""),root_(), watchFd_(-1) {
 	this->configPath_ = findConfigFile();
 	if (this->configPath_.empty()) {
 		throw std::runtime_error("No config file found.");
 	}
 	Logger::GetInstance()->Log("Config file found at: " + this->configPath_ ,L_INFO);
 }
-ConfigFileHandler::ConfigFileHandler(const std::string& configPath) : configPath_("") {
+ConfigFileHandler::ConfigFileHandler(const std::string& configPath) : configPath_(""), root_(), watchFd_(-1) {
 	if (fileExists(configPath)) {
 		this->configPath_ = configPath;
 	} else {
@@ -51,7 +53,10 @@ ConfigFileHandler::ConfigFileHandler(const std::string& configPath) : configPath
 	}
 	Logger::GetInstance()->Log("Using Config file : " + this->configPath_,L_INFO );
 }
-ConfigFileHandler::~ConfigFileHandler() {}
+ConfigFileHandler::~ConfigFileHandler() {
+	if (watchFd_ >= 0)
+		close(watchFd_);
+}
 bool ConfigFileHandler::fileExists(const std::string& path) {
 	std::ifstream f(path.c_str());
 	return f.good();
@@ -103,3 +108,42 @@ const Json::Value &ConfigFileHandler::getRoot() { return root_; }
 std::string ConfigFileHandler::getConfigPath() {
 	return configPath_;
 }
+
+int ConfigFileHandler::watch() {
+	if (watchFd_ >= 0)
+		return watchFd_;
+	watchFd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (watchFd_ < 0) {
+		Logger::GetInstance()->Log("Cannot watch config file: inotify_init1 failed",L_WARNING);
+		return -1;
+	}
+	size_t slash = configPath_.rfind('/');
+	std::string directory = slash == std::string::npos ? "." : configPath_.substr(0, slash + 1);
+	if (inotify_add_watch(watchFd_, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+		Logger::GetInstance()->Log("Cannot watch config directory " + directory,L_WARNING);
+		close(watchFd_);
+		watchFd_ = -1;
+		return -1;
+	}
+	Logger::GetInstance()->Log("Watching config file " + configPath_,L_INFO);
+	return watchFd_;
+}
+
+bool ConfigFileHandler::fileChanged() {
+	if (watchFd_ < 0)
+		return false;
+	size_t slash = configPath_.rfind('/');
+	std::string name = slash == std::string::npos ? configPath_ : configPath_.substr(slash + 1);
+	bool changed = false;
+	alignas(struct inotify_event) char buffer[4096];
+	ssize_t length;
+	while ((length = read(watchFd_, buffer, sizeof(buffer))) > 0) {
+		for (char *ptr = buffer; ptr < buffer + length;) {
+			auto *event = reinterpret_cast<struct inotify_event *>(ptr);
+			if (event->len > 0 && name == event->name)
+				changed = true;
+			ptr += sizeof(struct inotify_event) + event->len;
+		}
+	}
+	return changed;
+}
@@ -56,40 +56,118 @@ void ConfigHandler::Destroy() {
 	}
 }
 ConfigHandler::ConfigHandler() :
-	configPath_(){
+	configPath_(),
+	configFileHandler_(),
+	root_(){
 }
 ConfigHandler::ConfigHandler(const std::string& configPath) :
-	configPath_(configPath){
+	configPath_(configPath),
+	configFileHandler_(),
+	root_(){
+}
+
+bool ConfigHandler::checkRoot(const Json::Value &root) {
+	if (root.empty() || !root.isObject())
+		return false;
+	const Json::Value &Groups = root["Groups"];
+	const Json::Value &Bars = root["Bars"];
+	const Json::Value &Bindings = root["Bindings"];
+	return !(Groups.empty() || !Groups.isArray() || Bars.empty() || !Bars.isArray() || Bindings.empty() || !Bindings.isObject());
 }
 
 void ConfigHandler::configInit() {
-	std::unique_ptr<ConfigFileHandler> configFileHandler_;
 	if (configPath_.empty()) {
-		configFileHandler_ = std::make_unique<ConfigFileHandler>(ConfigFileHandler());
+		configFileHandler_ = std::make_unique<ConfigFileHandler>();
 	} else {
-		configFileHandler_ = std::make_unique<ConfigFileHandler>(ConfigFileHandler(configPath_));
+		configFileHandler_ = std::make_unique<ConfigFileHandler>(configPath_);
 	}
 	Logger::GetInstance()->Log("===================Loading Config===================",L_INFO);
 	configFileHandler_->readConfig();
 	configPath_ = configFileHandler_->getConfigPath();
-	const Json::Value &root_ = configFileHandler_->getRoot();
-	if (root_.empty() || !root_.isObject()) {
+	const Json::Value &root = configFileHandler_->getRoot();
+	if (root.empty() || !root.isObject()) {
 		throw std::runtime_error("Config file is empty or not an object");
 	}
-	Json::Value Groups = root_["Groups"];
-	Json::Value Bars = root_["Bars"];
-	Json::Value Bindings = root_["Bindings"];
-	if (Groups.empty() || !Groups.isArray() || Bars.empty() || !Bars.isArray() || Bindings.empty() || !Bindings.isObject()){
+	if (!checkRoot(root)){
 		throw std::runtime_error("Config file is missing Groups, Bars or Bindings See Documentation for more information");
 	}
 	addConfigData(std::make_shared<ConfigDataGroups>());
 	addConfigData(std::make_shared<ConfigDataBars>());
 	addConfigData(std::make_shared<ConfigDataBindings>());
-	getConfigData<ConfigDataGroups>()->configInit(Groups);
-	getConfigData<ConfigDataBars>()->configInit(Bars);
-	getConfigData<ConfigDataBindings>()->configInit(Bindings);
+	getConfigData<ConfigDataGroups>()->configInit(root["Groups"]);
+	getConfigData<ConfigDataBars>()->configInit(root["Bars"]);
+	getConfigData<ConfigDataBindings>()->configInit(root["Bindings"]);
+	root_ = root;
 	Logger::GetInstance()->Log("===================Succefully Loaded Config===================\n\n",L_INFO);
 }
+
+namespace {
+template <typename T>
+std::shared_ptr<T> parseSection(const Json::Value &section, const std::string &name) {
+	auto data = std::make_shared<T>();
+	try {
+		data->configInit(section);
+	} catch (const std::exception &e) {
+		Logger::GetInstance()->Log("Invalid " + name + " section, kept the current one: " + e.what(), L_ERROR);
+		return nullptr;
+	}
+	return data;
+}
+}
+
+ConfigReload ConfigHandler::reload() {
+	ConfigReload result;
+	result.previous = root_;
+	if (!configFileHandler_)
+		return result;
+	try {
+		configFileHandler_->readConfig();
+	} catch (const std::exception &e) {
+		Logger::GetInstance()->Log(std::string("Config reload failed: ") + e.what(), L_ERROR);
+		return result;
+	}
+	const Json::Value &root = configFileHandler_->getRoot();
+	if (!checkRoot(root)) {
+		Logger::GetInstance()->Log("Config reload ignored, the file is missing Groups, Bars or Bindings", L_ERROR);
+		return result;
+	}
+	if (root["Groups"] != root_["Groups"]) {
+		if (auto groups = parseSection<ConfigDataGroups>(root["Groups"], "Groups")) {
+			result.groups = getConfigData<ConfigDataGroups>();
+			addConfigData(groups);
+			root_["Groups"] = root["Groups"];
+		}
+	}
+	if (root["Bars"] != root_["Bars"]) {
+		if (auto bars = parseSection<ConfigDataBars>(root["Bars"], "Bars")) {
+			result.bars = getConfigData<ConfigDataBars>();
+			addConfigData(bars);
+			root_["Bars"] = root["Bars"];
+		}
+	}
+	if (root["Bindings"] != root_["Bindings"]) {
+		if (auto bindings = parseSection<ConfigDataBindings>(root["Bindings"], "Bindings")) {
+			result.bindings = getConfigData<ConfigDataBindings>();
+			addConfigData(bindings);
+			root_["Bindings"] = root["Bindings"];
+		}
+	}
+	Logger::GetInstance()->Log(std::string("Config reloaded, changed sections:")
+								+ (result.groups ? " Groups" : "")
+								+ (result.bars ? " Bars" : "")
+								+ (result.bindings ? " Bindings" : ""), L_INFO);
+	return result;
+}
+
+int ConfigHandler::watchConfigFile() {
+	return configFileHandler_ ? configFileHandler_->watch() : -1;
+}
+
+bool ConfigHandler::configFileChanged() {
+	return configFileHandler_ && configFileHandler_->fileChanged();
+}
+
+const Json::Value &ConfigHandler::getRoot() const { return root_; }
 ConfigHandler::~ConfigHandler() = default;
 unsigned long ConfigHandler::colorCodeToULong(const std::string& colorCode) {
 	if (colorCode.size() != 7 || colorCode[0] != '#' || !isxdigit(colorCode[1])) {
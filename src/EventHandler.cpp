@@ -35,6 +35,7 @@ extern "C" {
 };
 #include "Ewmh.hpp"
 #include "X11wrapper/baseX11Wrapper.hpp"
+#include "Ipc/IpcServer.hpp"
 
 std::string GetEventTypeName(int eventType) {
 	std::string name;
@@ -113,10 +114,15 @@ EventHandler::EventHandler() {
 	eventHandlerArray[ReparentNotify] = &EventHandler::handleReparentNotify;
 	eventHandlerArray[MapRequest] = &EventHandler::handleMapRequest;
 	eventHandlerArray[MotionNotify] = &EventHandler::handleMotionNotify;
+	eventHandlerArray[MappingNotify] = &EventHandler::handleMappingNotify;
 	wrapper = WindowManager::getInstance()->getX11Wrapper();
 }
 EventHandler::~EventHandler() = default;
 void EventHandler::dispatchEvent(const XEvent &event) {
+	if (event.type == WindowManager::getInstance()->getScreenChangeEvent()) {
+		handleScreenChange(event);
+		return;
+	}
 	std::string name = GetEventTypeName(event.xany.type);
 	if (event.type > 0 && event.type < LASTEvent && eventHandlerArray[event.type] != nullptr)
 		(this->*eventHandlerArray[event.type])(event);
@@ -145,10 +151,11 @@ void EventHandler::handleUnmapNotify(const XEvent &event) {
 		return;
 	}
 	if (e.window == WindowManager::getInstance()->getRoot()) {
-		ConfigHandler::GetInstance().getConfigData<ConfigDataBindings>()->grabKeys(WindowManager::getInstance()->getDisplay(),WindowManager::getInstance()->getRoot());
 		Logger::GetInstance()->Log("Ignoring unmap for root window", L_INFO);
 		return;
 	}
+	if (WindowManager::getInstance()->forgetDock(e.window))
+		return;
 	try {
 		auto client = WindowManager::getInstance()->getClientRef(e.window);
 		Logger::GetInstance()->Log("Unmapping window: " + client->getTitle(), L_INFO);
@@ -156,6 +163,9 @@ void EventHandler::handleUnmapNotify(const XEvent &event) {
 			client->setMapped(false);
 		}
 		else {
+			if (IpcServer *ipc = WindowManager::getInstance()->getIpcServer())
+				ipc->clientEvent(IPC_WINDOW, client.get(), "close");
+			WindowManager::getInstance()->removeFromClientList(client->getWindow());
 			client->unframe();
 			client->getGroup()->removeClient(client.get());
 			WindowManager::getInstance()->getClients().erase(e.window);
@@ -185,7 +195,11 @@ void EventHandler::handleButtonPress(const XEvent &event) {
 		Logger::GetInstance()->Log("Ignoring unmap for bar window", L_INFO);
 		return;
 	}
-	const Window frame = WindowManager::getInstance()->getClient(event.xbutton.window)->getFrame();
+	// the button is grabbed on the root, the client is the child of the root under the pointer
+	auto client = WindowManager::getInstance()->getClient(e.window == WindowManager::getInstance()->getRoot() ? e.subwindow : e.window);
+	if (client == nullptr)
+		return;
+	const Window frame = client->getFrame();
 	// give focus to the window
 	wrapper->setInputFocus(WindowManager::getInstance()->getDisplay(), frame, RevertToParent, CurrentTime);
 	// 1. Save initial cursor position.
@@ -205,12 +219,14 @@ void EventHandler::handleButtonPress(const XEvent &event) {
 //	drag_start_frame_pos_ = Position<int>(x, y);
 //	drag_start_frame_size_ = Size<int>(width, height);
 	// 3. Raise clicked window to top.
-	wrapper->raiseWindow(WindowManager::getInstance()->getDisplay(),frame);
+	client->restack();
 }
 void EventHandler::handleButtonRelease(const XEvent &event) {}
 void EventHandler::handleKeyPress(const XEvent &event) {
 	auto e = &event.xkey;
-	ConfigHandler::GetInstance().getConfigData<ConfigDataBindings>()->handleKeypressEvent(e);
+	WindowManager *wm = WindowManager::getInstance();
+	auto target = wm->getClient(e->subwindow != None ? e->subwindow : wm->getActiveWindow());
+	ConfigHandler::GetInstance().getConfigData<ConfigDataBindings>()->handleKeypressEvent(e, target.get());
 	wrapper->sync(WindowManager::getInstance()->getDisplay(),false);
 }
 void EventHandler::handleKeyRelease(const XEvent &event) {}
@@ -220,6 +236,7 @@ void EventHandler::handleEnterNotify(const XEvent &event) {
 		Bars::getInstance().redraw();
 		return;
 	}
+	WindowManager::getInstance()->pointerEntered(e);
 }
 void EventHandler::handleLeaveNotify(const XEvent &event) {}
 void EventHandler::handleExpose(const XEvent &event) {
@@ -241,6 +258,9 @@ void EventHandler::handleFocusIn(const XEvent &event) {
 		return;
 	}
 	else {
+		client->getGroup()->getLayoutManager()->focusClient(client);
+		if (IpcServer *ipc = WindowManager::getInstance()->getIpcServer())
+			ipc->clientEvent(IPC_FOCUS, client, "focus");
 		unsigned long ActiveColor = client->getGroup()->getActiveColor();
 		Logger::GetInstance()->Log("Window focused: " + client->getTitle() , L_INFO);
 		wrapper->setWindowBorder(WindowManager::getInstance()->getDisplay(), client->getFrame(), ActiveColor);
@@ -270,11 +290,22 @@ void EventHandler::handleFocusOut(const XEvent &event) {
 void EventHandler::handlePropertyNotify(const XEvent &event) {
 	XPropertyEvent e = event.xproperty;
 	Logger::GetInstance()->Log("PropertyNotify: " + std::to_string(e.atom), L_INFO);
+	if (WindowManager::getInstance()->updateDock(e.window, e.atom))
+		return;
+	Client * client = WindowManager::getInstance()->getClient(e.window).get();
+	if (client != nullptr && e.atom == WindowManager::getInstance()->getProtocolsAtom())
+		client->updateProtocols();
+	if (client == nullptr || !client->updateTitle(e.atom))
+		return;
+	if (IpcServer *ipc = WindowManager::getInstance()->getIpcServer())
+		ipc->clientEvent(IPC_TITLE, client, "title");
 }
 void EventHandler::handleClientMessage(const XEvent &event) {
 	XClientMessageEvent e = event.xclient;
 	Display * display = WindowManager::getInstance()->getDisplay();
 	Window root = WindowManager::getInstance()->getRoot();
+	if (WindowManager::getInstance()->handlePong(e))
+		return;
 	ewmh::handleMessage(&e, display, root);
 }
 void EventHandler::handleDestroyNotify(const XEvent &event) {
@@ -287,9 +318,14 @@ void EventHandler::handleDestroyNotify(const XEvent &event) {
 		Logger::GetInstance()->Log("Ignoring unmap for bar window", L_INFO);
 		return;
 	}
+	if (WindowManager::getInstance()->forgetDock(e.window))
+		return;
 	try {
 		auto client = WindowManager::getInstance()->getClientRef(e.window);
 		Logger::GetInstance()->Log("Destroying window: " + client->getTitle(), L_INFO);
+		if (IpcServer *ipc = WindowManager::getInstance()->getIpcServer())
+			ipc->clientEvent(IPC_WINDOW, client.get(), "close");
+		WindowManager::getInstance()->removeFromClientList(client->getWindow());
 		client->unframe();
 		WindowManager::getInstance()->getClients().erase(e.window);
 		client->getGroup()->removeClient(client.get());
@@ -330,6 +366,7 @@ void EventHandler::handleMapRequest(const XEvent &event) {
 			try {
 				client->frame();
 				client->getGroup()->addClient(client->getWindow(),client);
+				WindowManager::getInstance()->addToClientList(client->getWindow());
 				WindowManager::getInstance()->setFocus(client.get());
 			} catch (const std::exception &ex) {
 				Logger::GetInstance()->Log(ex.what(), L_ERROR);
@@ -339,24 +376,45 @@ void EventHandler::handleMapRequest(const XEvent &event) {
 		return;
 	}
 	catch (std::out_of_range &err) {
+		if (WindowManager::getInstance()->manageDock(e.window))
+			return;
 		Logger::GetInstance()->Log("Creating new client for window: " + std::to_string(e.window), L_INFO);
 		WindowManager::getInstance()->insertClient(e.window);
 		try {
 			auto c = WindowManager::getInstance()->getClientRef(e.window);
 			c->frame();
 			c->getGroup()->addClient(e.window,c);
+			c->updateTitle(XA_WM_NAME);
+			WindowManager::getInstance()->addToClientList(e.window);
+			if (IpcServer *ipc = WindowManager::getInstance()->getIpcServer())
+				ipc->clientEvent(IPC_WINDOW, c.get(), "new");
 		} catch (const std::exception &ex) {
 			Logger::GetInstance()->Log(ex.what(), L_ERROR);
 		}
 	}
 	wrapper->mapWindow(WindowManager::getInstance()->getDisplay(), e.window);
 }
+void EventHandler::handleMappingNotify(const XEvent &event) {
+	auto e = event.xmapping;
+	wrapper->refreshKeyboardMapping(&e);
+	if (e.request == MappingPointer)
+		return;
+	WindowManager *wm = WindowManager::getInstance();
+	ConfigHandler::GetInstance().getConfigData<ConfigDataBindings>()->refreshKeycodes(wm->getDisplay(), wrapper.get(), {wm->getRoot()});
+}
+void EventHandler::handleScreenChange(const XEvent &event) {
+	XEvent e = event;
+	WindowManager::getInstance()->updateOutputs(e);
+}
 void EventHandler::handleMotionNotify(const XEvent &event) {
 	auto e = event.xmotion;
 	if (Bars::getInstance().isBarWindow(e.window)) {
 		return;
 	}
-	const Window frame = WindowManager::getInstance()->getClientRef(event.xmotion.window)->getFrame();
+	auto client = WindowManager::getInstance()->getClient(e.window == WindowManager::getInstance()->getRoot() ? e.subwindow : e.window);
+	if (client == nullptr)
+		return;
+	const Window frame = client->getFrame();
 //	const Position<int> drag_pos(e.x_root, e.y_root);
 //	const Vector2D<int> delta = drag_pos - drag_start_pos_;
 //
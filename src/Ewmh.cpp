@@ -25,13 +25,68 @@
  * @date 2024-02-11
  */
 #include "Ewmh.hpp"
+#include <algorithm>
 #include <vector>
 #include "Logger.hpp"
 #include <stdexcept>
 #include "WindowManager.hpp"
+#include "Group.hpp"
+#include "Layouts/LayoutManager.hpp"
+#include <unordered_map>
 
 namespace ewmh {
+	namespace {
+		typedef void (*MessageHandler)(const XClientMessageEvent &event);
+		std::unordered_map<Atom, MessageHandler> handlers;
+		Atom wmState = None;
+		Atom wmStateFullscreen = None;
+
+		void activeWindow(const XClientMessageEvent &event) {
+			WindowManager *wm = WindowManager::getInstance();
+			auto client = wm->getClient(event.window);
+			if (!client)
+				return;
+			wm->switchToGroup(wm->getGroupIndex(client->getGroup()));
+			wm->setFocus(client.get());
+			client->restack();
+		}
+		void currentDesktop(const XClientMessageEvent &event) {
+			WindowManager::getInstance()->switchToGroup(static_cast<size_t>(event.data.l[0]));
+		}
+		void wmDesktop(const XClientMessageEvent &event) {
+			WindowManager *wm = WindowManager::getInstance();
+			auto client = wm->getClient(event.window);
+			if (client)
+				wm->moveClientToGroup(client.get(), static_cast<size_t>(event.data.l[0]));
+		}
+		void wmStateChange(const XClientMessageEvent &event) {
+			WindowManager *wm = WindowManager::getInstance();
+			auto client = wm->getClient(event.window);
+			if (!client)
+				return;
+			for (int i = 1; i <= 2; i++) {
+				if (static_cast<Atom>(event.data.l[i]) != wmStateFullscreen)
+					continue;
+				// 0 remove, 1 add, 2 toggle
+				bool fullscreen = event.data.l[0] == 2 ? !client->isFullscreen() : event.data.l[0] == 1;
+				wm->setFullscreen(client.get(), fullscreen);
+			}
+		}
+		void closeWindow(const XClientMessageEvent &event) {
+			auto client = WindowManager::getInstance()->getClient(event.window);
+			if (client)
+				client->close();
+		}
+	}
 	void initEwmh(Display *display, Window root) {
+		wmState = XInternAtom(display, "_NET_WM_STATE", False);
+		wmStateFullscreen = XInternAtom(display, "_NET_WM_STATE_FULLSCREEN", False);
+		handlers.clear();
+		handlers[XInternAtom(display, "_NET_ACTIVE_WINDOW", False)] = &activeWindow;
+		handlers[XInternAtom(display, "_NET_CURRENT_DESKTOP", False)] = &currentDesktop;
+		handlers[XInternAtom(display, "_NET_WM_DESKTOP", False)] = &wmDesktop;
+		handlers[wmState] = &wmStateChange;
+		handlers[XInternAtom(display, "_NET_CLOSE_WINDOW", False)] = &closeWindow;
 		Atom netSupported = XInternAtom(display, "_NET_SUPPORTED", False);
 		std::vector<Atom> supportedAtoms = {
 				XInternAtom(display, "_NET_WM_NAME", False),
@@ -39,7 +94,18 @@ namespace ewmh {
 				XInternAtom(display, "_NET_ACTIVE_WINDOW",False),
 				XInternAtom(display, "_NET_NUMBER_OF_DESKTOPS",False),
 				XInternAtom(display, "_NET_WM_STATE",False),
-				XInternAtom(display, "_NET_DESKTOP_GEOMETRY",False)
+				XInternAtom(display, "_NET_DESKTOP_GEOMETRY",False),
+				XInternAtom(display, "_NET_CLIENT_LIST",False),
+				XInternAtom(display, "_NET_CLIENT_LIST_STACKING",False),
+				XInternAtom(display, "_NET_WORKAREA",False),
+				XInternAtom(display, "_NET_WM_STRUT",False),
+				XInternAtom(display, "_NET_WM_STRUT_PARTIAL",False),
+				XInternAtom(display, "_NET_WM_WINDOW_TYPE",False),
+				XInternAtom(display, "_NET_WM_WINDOW_TYPE_DOCK",False),
+				XInternAtom(display, "_NET_WM_PING",False),
+				XInternAtom(display, "_NET_CURRENT_DESKTOP",False),
+				XInternAtom(display, "_NET_WM_STATE_FULLSCREEN",False),
+				XInternAtom(display, "_NET_CLOSE_WINDOW",False)
 				// Add other supported atoms here
 		};
 		// Register _NET_SUPPORTED property
@@ -53,53 +119,34 @@ namespace ewmh {
 				reinterpret_cast<unsigned char*>(supportedAtoms.data()), // New value
 				supportedAtoms.size()            // Number of elements in the new value
 		);
+		updateClientList(display, root, {});
+		updateClientListStacking(display, root, {});
 		XFlush(display);
 		Logger::GetInstance()->Log("EWMH atoms registered", L_INFO);
 	}
 
 	void handleMessage(XClientMessageEvent *event, Display *display, Window root) {
-		Atom wmName = XInternAtom(display, "_NET_WM_NAME", False);
-		Atom wmDesktop = XInternAtom(display, "_NET_WM_DESKTOP", False);
-		Atom activeWindow = XInternAtom(display, "_NET_ACTIVE_WINDOW",False);
-		Atom numbersOfDesktops = XInternAtom(display, "_NET_NUMBER_OF_DESKTOPS",False);
-		Atom wmState  = XInternAtom(display, "_NET_WM_STATE", False);
-		Atom desktopGeometry = XInternAtom(display, "_NET_DESKTOP_GEOMETRY",False);
-		if (wmName != None
-			&& wmDesktop != None
-			&& activeWindow != None
-			&& numbersOfDesktops != None
-			&& wmState != None
-			&& desktopGeometry != None){
-			if (event->message_type == wmName) {
-				Logger::GetInstance()->Log("Received _NET_WM_NAME message", L_INFO);
-				// Handle _NET_WM_NAME
-			} else if (event->message_type == wmDesktop) {
-				Logger::GetInstance()->Log("Received _NET_WM_DESKTOP message", L_INFO);
-				// Handle _NET_WM_DESKTOP
-			} else if (event->message_type == activeWindow) {
-				Logger::GetInstance()->Log("Received _NET_ACTIVE_WINDOW message", L_INFO);
-				// Handle _NET_ACTIVE_WINDOW
-			} else if (event->message_type == numbersOfDesktops) {
-				Logger::GetInstance()->Log("Received _NET_NUMBER_OF_DESKTOPS message", L_INFO);
-			} else if (event->message_type == wmState) {
-				Logger::GetInstance()->Log("Received _NET_WM_STATE message", L_INFO);
-				// Handle _NET_WM_STATE
-			} else {
-				Logger::GetInstance()->Log("Unknown message type: " + std::to_string(event->message_type), L_WARNING);
-			}
+		(void)display;
+		(void)root;
+		auto it = handlers.find(event->message_type);
+		if (it == handlers.end()) {
+			Logger::GetInstance()->Log("Unhandled client message: " + std::to_string(event->message_type), L_INFO);
+			return;
 		}
+		LayoutBatch batch;
+		it->second(*event);
 	}
 	void updateNumberOfDesktops(Display *display, Window root) {
 		Atom numbersOfDesktops = XInternAtom(display, "_NET_NUMBER_OF_DESKTOPS",False);
 		if (numbersOfDesktops != None) {
-			unsigned int n = WindowManager::getInstance()->getGroups().size();
+			long n = static_cast<long>(WindowManager::getInstance()->getGroups().size());
 			XChangeProperty(display, root, numbersOfDesktops, XA_CARDINAL, 32, PropModeReplace,reinterpret_cast<unsigned char*>(&n), 1);
 		}
 	}
 	void updateDesktopGeometry(Display *display, Window root) {
 		Atom desktopGeometry = XInternAtom(display, "_NET_DESKTOP_GEOMETRY", False);
-		uint32_t size[2] = {static_cast<uint32_t>(WindowManager::getInstance()->getGeometryX()),
-								static_cast<uint32_t>(WindowManager::getInstance()->getGeometryY())};
+		long size[2] = {static_cast<long>(WindowManager::getInstance()->getGeometryX()),
+						static_cast<long>(WindowManager::getInstance()->getGeometryY())};
 		Logger::GetInstance()->Log("Size registered :\t" + std::to_string(size[0]) + " x " + std::to_string(size[1]), L_INFO);
 		XChangeProperty(display,
 						root,
@@ -121,6 +168,99 @@ namespace ewmh {
 						(unsigned char*)&activeWindow,
 						1);
 	}
+	void appendClientList(Display *display, Window root, Window client) {
+		for (const char *name : {"_NET_CLIENT_LIST", "_NET_CLIENT_LIST_STACKING"}) {
+			XChangeProperty(display,
+							root,
+							XInternAtom(display, name, False),
+							XA_WINDOW,
+							32,
+							PropModeAppend,
+							reinterpret_cast<unsigned char*>(&client),
+							1);
+		}
+	}
+	void updateClientList(Display *display, Window root, const std::vector<Window> &clients) {
+		XChangeProperty(display,
+						root,
+						XInternAtom(display, "_NET_CLIENT_LIST", False),
+						XA_WINDOW,
+						32,
+						PropModeReplace,
+						reinterpret_cast<const unsigned char*>(clients.data()),
+						static_cast<int>(clients.size()));
+	}
+	void updateClientListStacking(Display *display, Window root, const std::vector<Window> &clients) {
+		XChangeProperty(display,
+						root,
+						XInternAtom(display, "_NET_CLIENT_LIST_STACKING", False),
+						XA_WINDOW,
+						32,
+						PropModeReplace,
+						reinterpret_cast<const unsigned char*>(clients.data()),
+						static_cast<int>(clients.size()));
+	}
+	void updateWorkArea(Display *display, Window root, int x, int y, unsigned int width, unsigned int height, size_t desktops) {
+		std::vector<long> area;
+		area.reserve(desktops * 4);
+		for (size_t i = 0; i < desktops; i++)
+			area.insert(area.end(), {x, y, static_cast<long>(width), static_cast<long>(height)});
+		XChangeProperty(display,
+						root,
+						XInternAtom(display, "_NET_WORKAREA", False),
+						XA_CARDINAL,
+						32,
+						PropModeReplace,
+						reinterpret_cast<unsigned char*>(area.data()),
+						static_cast<int>(area.size()));
+	}
+	void updateCurrentDesktop(Display *display, Window root, size_t index) {
+		long desktop = static_cast<long>(index);
+		XChangeProperty(display,
+						root,
+						XInternAtom(display, "_NET_CURRENT_DESKTOP", False),
+						XA_CARDINAL,
+						32,
+						PropModeReplace,
+						reinterpret_cast<unsigned char*>(&desktop),
+						1);
+	}
+	void updateWmDesktop(Display *display, Window window, size_t index) {
+		long desktop = static_cast<long>(index);
+		XChangeProperty(display,
+						window,
+						XInternAtom(display, "_NET_WM_DESKTOP", False),
+						XA_CARDINAL,
+						32,
+						PropModeReplace,
+						reinterpret_cast<unsigned char*>(&desktop),
+						1);
+	}
+	void updateWmState(Display *display, Window window, bool fullscreen) {
+		Atom actualType = None;
+		int actualFormat = 0;
+		unsigned long nItems = 0, bytesAfter = 0;
+		unsigned char *data = nullptr;
+		std::vector<Atom> states;
+		if (XGetWindowProperty(display, window, wmState, 0, 1024, False, XA_ATOM, &actualType, &actualFormat,
+							   &nItems, &bytesAfter, &data) == Success && data != nullptr) {
+			if (actualType == XA_ATOM && actualFormat == 32)
+				states.assign(reinterpret_cast<Atom*>(data), reinterpret_cast<Atom*>(data) + nItems);
+			XFree(data);
+		}
+		// keep the states set by the client or other tools, only toggle the one we manage
+		states.erase(std::remove(states.begin(), states.end(), wmStateFullscreen), states.end());
+		if (fullscreen)
+			states.push_back(wmStateFullscreen);
+		XChangeProperty(display,
+						window,
+						wmState,
+						XA_ATOM,
+						32,
+						PropModeReplace,
+						reinterpret_cast<const unsigned char*>(states.data()),
+						static_cast<int>(states.size()));
+	}
 	void updateWmProperties(Display *display, Window root) {
 		updateNumberOfDesktops(display, root);
 		updateDesktopGeometry(display,root);
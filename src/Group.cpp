@@ -30,6 +30,8 @@
 #include <utility>
 #include "Client.hpp"
 #include "Layouts/LayoutManager.hpp"
+#include "Layouts/MasterLayoutManager.hpp"
+#include "Layouts/MaxLayoutManager.hpp"
 #include "Config/ConfigDataBindings.hpp"
 
 Group::Group(const std::shared_ptr<ConfigDataGroup>& config,
@@ -37,6 +39,7 @@ Group::Group(const std::shared_ptr<ConfigDataGroup>& config,
 			 Display *display,
 			 Window root) {
 	name_ = config->getGroupName();
+	layoutName_ = config->getGroupLayout();
 	LayoutType layoutType;
 	if (config->getGroupLayout() == "Tree") {
 		layoutType = TREE;
@@ -72,9 +75,18 @@ Group::Group(const std::shared_ptr<ConfigDataGroup>& config,
 												   barHeight_);
 			break;
 		case MAX:
+			layoutManager_ = std::make_shared<MaxLayoutManager>(display,
+												   root,
+												   size_x,
+												   size_y,
+												   0,
+												   0,
+												   borderSize_,
+												   gap_,
+												   barHeight_);
 			break;
 		case MASTER_VERTICAL:
-			layoutManager_ = std::make_shared<TreeLayoutManager>(display,
+			layoutManager_ = std::make_shared<MasterLayoutManager>(display,
 												   root,
 												   size_x,
 												   size_y,
@@ -82,10 +94,11 @@ Group::Group(const std::shared_ptr<ConfigDataGroup>& config,
 												   0,
 												   borderSize_,
 												   gap_,
-												   barHeight_);
+												   barHeight_,
+												   true);
 			break;
 		case MASTER_HORIZONTAL:
-			layoutManager_ = std::make_shared<TreeLayoutManager>(display,
+			layoutManager_ = std::make_shared<MasterLayoutManager>(display,
 												   root,
 												   size_x,
 												   size_y,
@@ -93,7 +106,8 @@ Group::Group(const std::shared_ptr<ConfigDataGroup>& config,
 												   0,
 												   borderSize_,
 												   gap_,
-												   barHeight_);
+												   barHeight_,
+												   false);
 			break;
 		default:
 			layoutManager_ = std::make_shared<TreeLayoutManager>(display,
@@ -138,13 +152,18 @@ void Group::moveClientToGroup(Window window, Group *group) {
 }
 void Group::switchTo() {
 	Logger::GetInstance()->Log("Group switched to [" + name_ + "]", L_INFO);
+	show();
+	WindowManager::getInstance()->setActiveGroup(shared_from_this());
+}
+void Group::show() {
+	if (resizePending_)
+		resize(pendingGeometry_[0], pendingGeometry_[1], pendingGeometry_[2], pendingGeometry_[3]);
 	for (auto &client: WindowManager::getInstance()->getClients()) {
-		if (client.second->getGroup().get() == this) {
+		if (client.second->getGroup().get() == this && layoutManager_->isVisible(client.second.get())) {
 			wrapper->mapWindow(WindowManager::getInstance()->getDisplay(), client.second->getFrame());
 		}
 	}
 	this->active_= true;
-	WindowManager::getInstance()->setActiveGroup(shared_from_this());
 }
 void Group::switchFrom() {
 	Logger::GetInstance()->Log("Group switched from [" + name_ + "]", L_INFO);
@@ -170,5 +189,43 @@ unsigned long Group::getInactiveColor() const { return inactiveColor_; }
 unsigned long Group::getActiveColor() const { return activeColor_; }
 
 void Group::resize(unsigned int sizeX, unsigned int sizeY, unsigned int posX, unsigned int posY) {
+	resizePending_ = false;
 	layoutManager_->updateGeometry(sizeX, sizeY, posX, posY);
 }
+
+void Group::resizeLater(unsigned int sizeX, unsigned int sizeY, unsigned int posX, unsigned int posY) {
+	resizePending_ = true;
+	pendingGeometry_[0] = sizeX;
+	pendingGeometry_[1] = sizeY;
+	pendingGeometry_[2] = posX;
+	pendingGeometry_[3] = posY;
+}
+
+void Group::applyConfig(const std::shared_ptr<ConfigDataGroup> &config) {
+	if (config->getGroupName() != name_ || (config->getGroupLayout() != layoutName_))
+		Logger::GetInstance()->Log("Group [" + name_ + "] name or layout changed, applied on restart", L_WARNING);
+	bool spacing = config->getGroupBorderWidth() != borderSize_ || config->getGroupGap() != gap_;
+	bool borders = config->getGroupBorderWidth() != borderSize_
+				   || config->getGroupInactiveColor() != inactiveColor_
+				   || config->getGroupActiveColor() != activeColor_;
+	borderSize_ = config->getGroupBorderWidth();
+	gap_ = config->getGroupGap();
+	inactiveColor_ = config->getGroupInactiveColor();
+	activeColor_ = config->getGroupActiveColor();
+	if (borders && !clients_.empty()) {
+		Display *display = WindowManager::getInstance()->getDisplay();
+		Window active = WindowManager::getInstance()->getActiveWindow();
+		for (auto &client : clients_) {
+			if (!client.second || !client.second->isFramed())
+				continue;
+			XWindowChanges changes;
+			changes.border_width = borderSize_;
+			wrapper->configureWindow(display, client.second->getFrame(), CWBorderWidth, &changes);
+			wrapper->setWindowBorder(display, client.second->getFrame(),
+									 client.first == active ? activeColor_ : inactiveColor_);
+		}
+	}
+	if (spacing)
+		layoutManager_->setSpacing(borderSize_, gap_);
+	Logger::GetInstance()->Log("Group [" + name_ + "] configuration reloaded", L_INFO);
+}
@@ -0,0 +1,112 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file EventQueue.cpp
+ * @brief EventQueue class implementation.
+ * @date 2026-10-19
+ */
+#include "Ipc/EventQueue.hpp"
+
+EventQueue::EventQueue(size_t capacity)
+		: entries_(),
+		  pending_(),
+		  head_(0),
+		  live_(0),
+		  capacity_(capacity > 0 ? capacity : 1),
+		  dropped_(0),
+		  coalesced_(0),
+		  delivered_(0) {}
+
+void EventQueue::push(std::string payload, const std::string &type, uint64_t key, bool coalesce) {
+	Key k(type, key);
+	if (coalesce) {
+		auto it = pending_.find(k);
+		if (it != pending_.end()) {
+			Entry &old = entries_[it->second - head_];
+			old.live = false;
+			old.payload.clear();
+			live_--;
+			coalesced_++;
+			pending_.erase(it);
+		}
+	}
+	while (live_ >= capacity_)
+		dropFront();
+	if (coalesce)
+		pending_[k] = head_ + entries_.size();
+	entries_.push_back(Entry{std::move(payload), std::move(k), coalesce, true});
+	live_++;
+	if (entries_.size() > 2 * capacity_)
+		compact();
+}
+
+bool EventQueue::pop(std::string &payload) {
+	while (!entries_.empty() && !entries_.front().live) {
+		entries_.pop_front();
+		head_++;
+	}
+	if (entries_.empty())
+		return false;
+	Entry &entry = entries_.front();
+	payload = std::move(entry.payload);
+	if (entry.coalesce)
+		pending_.erase(entry.key);
+	entries_.pop_front();
+	head_++;
+	live_--;
+	delivered_++;
+	return true;
+}
+
+void EventQueue::dropFront() {
+	while (!entries_.empty() && !entries_.front().live) {
+		entries_.pop_front();
+		head_++;
+	}
+	if (entries_.empty())
+		return;
+	if (entries_.front().coalesce)
+		pending_.erase(entries_.front().key);
+	entries_.pop_front();
+	head_++;
+	live_--;
+	dropped_++;
+}
+
+void EventQueue::compact() {
+	std::deque<Entry> live;
+	head_ += entries_.size();
+	for (auto &entry : entries_) {
+		if (!entry.live)
+			continue;
+		if (entry.coalesce)
+			pending_[entry.key] = head_ + live.size();
+		live.push_back(std::move(entry));
+	}
+	entries_.swap(live);
+}
+
+size_t EventQueue::size() const { return live_; }
+size_t EventQueue::getCapacity() const { return capacity_; }
+uint64_t EventQueue::getDropped() const { return dropped_; }
+uint64_t EventQueue::getCoalesced() const { return coalesced_; }
+uint64_t EventQueue::getDelivered() const { return delivered_; }
@@ -0,0 +1,449 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file IpcServer.cpp
+ * @brief IpcServer class implementation.
+ * @date 2026-10-19
+ */
+#include "Ipc/IpcServer.hpp"
+#include "WindowManager.hpp"
+#include "Group.hpp"
+#include "Client.hpp"
+#include "Logger.hpp"
+#include "Config/Binding.hpp"
+#include "Layouts/LayoutManager.hpp"
+#include "X11wrapper/baseX11Wrapper.hpp"
+#include <memory>
+#include <vector>
+#include <cerrno>
+#include <cstring>
+#include <cstdlib>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+IpcServer::IpcServer(std::string path) : path_(std::move(path)), listenFd_(-1), connections_(), topics_(0), handling_(false), dirty_() {}
+
+IpcServer::~IpcServer() {
+	stop();
+}
+
+bool IpcServer::start() {
+	sockaddr_un addr{};
+	if (path_.size() >= sizeof(addr.sun_path)) {
+		Logger::GetInstance()->Log("IPC socket path too long: " + path_, L_ERROR);
+		return false;
+	}
+	listenFd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+	if (listenFd_ < 0) {
+		Logger::GetInstance()->Log("IPC socket failed: " + std::string(strerror(errno)), L_ERROR);
+		return false;
+	}
+	addr.sun_family = AF_UNIX;
+	strncpy(addr.sun_path, path_.c_str(), sizeof(addr.sun_path) - 1);
+	unlink(path_.c_str());
+	// Spawn runs arbitrary commands, only the owner may connect
+	mode_t mask = umask(0077);
+	int bound = bind(listenFd_, reinterpret_cast<sockaddr *>(&addr), sizeof(addr));
+	umask(mask);
+	if (bound < 0 || listen(listenFd_, 16) < 0) {
+		Logger::GetInstance()->Log("IPC bind failed on " + path_ + ": " + std::string(strerror(errno)), L_ERROR);
+		close(listenFd_);
+		listenFd_ = -1;
+		return false;
+	}
+	setenv("YGGDRASIL_SOCKET", path_.c_str(), 1);
+	WindowManager::getInstance()->watchFd(listenFd_, [this]() { acceptClients(); });
+	Logger::GetInstance()->Log("IPC listening on " + path_, L_INFO);
+	return true;
+}
+
+void IpcServer::stop() {
+	while (!connections_.empty())
+		closeClient(connections_.begin()->first);
+	if (listenFd_ < 0)
+		return;
+	try {
+		WindowManager::getInstance()->unwatchFd(listenFd_);
+	} catch (const std::exception &e) {}
+	close(listenFd_);
+	unlink(path_.c_str());
+	listenFd_ = -1;
+}
+
+void IpcServer::acceptClients() {
+	int fd;
+	while ((fd = accept4(listenFd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0) {
+		ucred peer{};
+		socklen_t length = sizeof(peer);
+		if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &peer, &length) < 0 || peer.uid != getuid()) {
+			Logger::GetInstance()->Log("IPC connection refused for uid " + std::to_string(peer.uid), L_WARNING);
+			close(fd);
+			continue;
+		}
+		connections_[fd] = Connection();
+		WindowManager::getInstance()->watchFd(fd, [this, fd]() { readClient(fd); });
+	}
+}
+
+void IpcServer::readClient(int fd) {
+	auto it = connections_.find(fd);
+	if (it == connections_.end())
+		return;
+	char buffer[4096];
+	ssize_t length;
+	while ((length = read(fd, buffer, sizeof(buffer))) > 0)
+		it->second.input.append(buffer, static_cast<size_t>(length));
+	if (length == 0 || (length < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+		closeClient(fd);
+		return;
+	}
+	std::string payload;
+	handling_ = true;
+	try {
+		while (decodeFrame(it->second.input, payload))
+			it->second.output += encodeFrame(handleRequest(payload, &it->second));
+	} catch (const std::exception &e) {
+		Logger::GetInstance()->Log(std::string("IPC client dropped: ") + e.what(), L_WARNING);
+		closeClient(fd);
+	}
+	handling_ = false;
+	std::vector<int> dirty;
+	dirty.swap(dirty_);
+	dirty.push_back(fd);
+	for (int d : dirty)
+		flushClient(d);
+}
+
+void IpcServer::flushClient(int fd) {
+	auto it = connections_.find(fd);
+	if (it == connections_.end())
+		return;
+	std::string &output = it->second.output;
+	while (!output.empty() || refill(it->second)) {
+		ssize_t written = send(fd, output.data(), output.size(), MSG_NOSIGNAL);
+		if (written < 0) {
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+				break;
+			closeClient(fd);
+			return;
+		}
+		output.erase(0, static_cast<size_t>(written));
+	}
+	if (output.size() > 4 * maxFrameSize) {
+		Logger::GetInstance()->Log("IPC client does not read its replies, dropped", L_WARNING);
+		closeClient(fd);
+		return;
+	}
+	WindowManager::getInstance()->setWatchedEvents(fd, output.empty() ? POLLIN : POLLIN | POLLOUT);
+}
+
+void IpcServer::closeClient(int fd) {
+	try {
+		WindowManager::getInstance()->unwatchFd(fd);
+	} catch (const std::exception &e) {}
+	connections_.erase(fd);
+	close(fd);
+	topics_ = 0;
+	for (const auto &connection : connections_)
+		topics_ |= connection.second.topics;
+}
+
+bool IpcServer::refill(Connection &connection) {
+	if (!connection.events)
+		return false;
+	std::string frame;
+	while (connection.output.size() < 64 * 1024 && connection.events->pop(frame))
+		connection.output += frame;
+	return !connection.output.empty();
+}
+
+bool IpcServer::wants(IpcTopic topic) const { return (topics_ & topic) != 0; }
+
+void IpcServer::publish(IpcTopic topic, uint64_t key, Json::Value event) {
+	if (!wants(topic))
+		return;
+	static const std::unordered_map<unsigned int, std::string> names = {
+			{IPC_WINDOW, "window"}, {IPC_FOCUS, "focus"}, {IPC_TITLE, "title"},
+			{IPC_GROUP, "group"}, {IPC_LAYOUT, "layout"}};
+	const std::string &name = names.at(topic);
+	event["Event"] = name;
+	Json::StreamWriterBuilder writer;
+	writer["indentation"] = "";
+	std::string frame = encodeFrame(Json::writeString(writer, event));
+	std::vector<int> ready;
+	for (auto &connection : connections_) {
+		if (!(connection.second.topics & topic))
+			continue;
+		connection.second.events->push(frame, name, key, topic != IPC_WINDOW);
+		if (connection.second.output.empty())
+			ready.push_back(connection.first);
+	}
+	for (int fd : ready) {
+		if (handling_)
+			dirty_.push_back(fd);
+		else
+			flushClient(fd);
+	}
+}
+
+void IpcServer::clientEvent(IpcTopic topic, const Client *client, const std::string &change) {
+	if (!wants(topic) || client == nullptr)
+		return;
+	Json::Value event;
+	event["Change"] = change;
+	event["Window"] = static_cast<Json::UInt64>(client->getWindow());
+	event["Title"] = client->getTitle();
+	event["Class"] = client->getClass();
+	auto group = client->getGroup();
+	event["Group"] = group ? group->getName() : "";
+	publish(topic, topic == IPC_FOCUS ? 0 : client->getWindow(), event);
+}
+
+void IpcServer::groupEvent(const std::shared_ptr<Group> &group, size_t index) {
+	if (!wants(IPC_GROUP) || !group)
+		return;
+	Json::Value event;
+	event["Group"] = group->getName();
+	event["Index"] = static_cast<Json::UInt64>(index);
+	publish(IPC_GROUP, 0, event);
+}
+
+void IpcServer::layoutEvent(const LayoutManager *layout) {
+	if (!wants(IPC_LAYOUT))
+		return;
+	const auto &groups = WindowManager::getInstance()->getGroups();
+	for (size_t i = 0; i < groups.size(); i++) {
+		if (groups[i]->getLayoutManager().get() != layout)
+			continue;
+		Json::Value event;
+		event["Group"] = groups[i]->getName();
+		event["Index"] = static_cast<Json::UInt64>(i);
+		event["Clients"] = static_cast<Json::UInt64>(groups[i]->getClients().size());
+		publish(IPC_LAYOUT, i, event);
+		return;
+	}
+}
+
+std::string IpcServer::encodeFrame(const std::string &payload) {
+	auto length = static_cast<uint32_t>(payload.size());
+	std::string frame;
+	frame.reserve(payload.size() + 4);
+	frame.push_back(static_cast<char>((length >> 24) & 0xff));
+	frame.push_back(static_cast<char>((length >> 16) & 0xff));
+	frame.push_back(static_cast<char>((length >> 8) & 0xff));
+	frame.push_back(static_cast<char>(length & 0xff));
+	frame += payload;
+	return frame;
+}
+
+bool IpcServer::decodeFrame(std::string &buffer, std::string &payload) {
+	if (buffer.size() < 4)
+		return false;
+	uint32_t length = 0;
+	for (int i = 0; i < 4; i++)
+		length = (length << 8) | static_cast<unsigned char>(buffer[i]);
+	if (length > maxFrameSize)
+		throw std::runtime_error("IPC message too long");
+	if (buffer.size() < 4 + static_cast<size_t>(length))
+		return false;
+	payload.assign(buffer, 4, length);
+	buffer.erase(0, 4 + static_cast<size_t>(length));
+	return true;
+}
+
+std::string IpcServer::defaultPath(const std::string &display) {
+	std::string name;
+	for (char c : display) {
+		if (isalnum(static_cast<unsigned char>(c)) || c == '.')
+			name.push_back(c);
+	}
+	const char *runtime = std::getenv("XDG_RUNTIME_DIR");
+	if (runtime != nullptr && runtime[0] != '\0')
+		return std::string(runtime) + "/yggdrasilwm-" + name + ".sock";
+	return "/tmp/yggdrasilwm-" + std::to_string(getuid()) + "-" + name + ".sock";
+}
+
+const std::string &IpcServer::getPath() const { return path_; }
+
+std::string IpcServer::handleRequest(const std::string &payload) {
+	return handleRequest(payload, nullptr);
+}
+
+std::string IpcServer::handleRequest(const std::string &payload, Connection *connection) {
+	Json::Value reply;
+	reply["Ok"] = false;
+	try {
+		Json::Value request;
+		Json::CharReaderBuilder builder;
+		std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
+		std::string errors;
+		if (!reader->parse(payload.data(), payload.data() + payload.size(), &request, &errors) || !request.isObject())
+			throw std::runtime_error("invalid JSON request " + errors);
+		if (request.isMember("Commands"))
+			reply["Data"] = runCommands(request["Commands"]);
+		else if (request.isMember("Subscribe"))
+			reply["Data"] = subscribe(request["Subscribe"], connection);
+		else if (request.isMember("Query") && request["Query"].asString() == "subscribers")
+			reply["Data"] = subscribers();
+		else if (request.isMember("Query"))
+			reply["Data"] = query(request["Query"].asString());
+		else
+			throw std::runtime_error("request without Commands, Subscribe or Query");
+		reply["Ok"] = true;
+	} catch (const std::exception &e) {
+		reply["Error"] = e.what();
+	}
+	Json::StreamWriterBuilder writer;
+	writer["indentation"] = "";
+	return Json::writeString(writer, reply);
+}
+
+Json::Value IpcServer::runCommands(const Json::Value &commands) {
+	if (!commands.isArray())
+		throw std::runtime_error("Commands must be an array");
+	std::vector<std::unique_ptr<CommandBase>> prepared;
+	std::vector<Window> targets;
+	for (const auto &command : commands) {
+		std::unique_ptr<CommandBase> c(Binding::createCommand(command["Action"].asString()));
+		c->prepare(command["Argument"].asString());
+		prepared.push_back(std::move(c));
+		if (command.isMember("Target") && !command["Target"].isUInt64())
+			throw std::runtime_error("invalid Target, a window id is expected");
+		targets.push_back(command.isMember("Target") ? static_cast<Window>(command["Target"].asUInt64()) : None);
+	}
+	// resolve every target before running anything, an invalid request must not be half applied
+	WindowManager *wm = WindowManager::getInstance();
+	std::vector<CommandContext> contexts(commands.size());
+	for (Json::ArrayIndex i = 0; i < commands.size(); i++) {
+		contexts[i].target = wm->getClient(targets[i] != None ? targets[i] : wm->getActiveWindow()).get();
+		if (targets[i] != None && contexts[i].target == nullptr)
+			throw std::runtime_error("unknown Target: " + std::to_string(targets[i]));
+	}
+	Json::Value results(Json::arrayValue);
+	{
+		LayoutBatch batch;
+		for (Json::ArrayIndex i = 0; i < commands.size(); i++) {
+			try {
+				prepared[i]->execute(contexts[i]);
+				results.append("ok");
+			} catch (const std::exception &e) {
+				results.append(e.what());
+			}
+		}
+	}
+	wm->getX11Wrapper()->flush(wm->getDisplay());
+	return results;
+}
+
+Json::Value IpcServer::subscribe(const Json::Value &topics, Connection *connection) {
+	static const std::unordered_map<std::string, unsigned int> masks = {
+			{"window", IPC_WINDOW}, {"focus", IPC_FOCUS}, {"title", IPC_TITLE},
+			{"group", IPC_GROUP}, {"layout", IPC_LAYOUT}};
+	if (connection == nullptr)
+		throw std::runtime_error("Subscribe needs a connection");
+	if (!topics.isArray())
+		throw std::runtime_error("Subscribe must be an array");
+	unsigned int mask = 0;
+	for (const auto &topic : topics) {
+		auto it = masks.find(topic.asString());
+		if (it == masks.end())
+			throw std::runtime_error("unknown topic: " + topic.asString());
+		mask |= it->second;
+	}
+	if (!connection->events)
+		connection->events = std::unique_ptr<EventQueue>(new EventQueue(subscriberQueueSize));
+	connection->topics |= mask;
+	topics_ |= mask;
+	return topics;
+}
+
+Json::Value IpcServer::subscribers() const {
+	Json::Value data(Json::arrayValue);
+	for (const auto &connection : connections_) {
+		const EventQueue *events = connection.second.events.get();
+		if (events == nullptr)
+			continue;
+		Json::Value s;
+		s["Topics"] = connection.second.topics;
+		s["Queued"] = static_cast<Json::UInt64>(events->size());
+		s["Capacity"] = static_cast<Json::UInt64>(events->getCapacity());
+		s["Delivered"] = static_cast<Json::UInt64>(events->getDelivered());
+		s["Coalesced"] = static_cast<Json::UInt64>(events->getCoalesced());
+		s["Dropped"] = static_cast<Json::UInt64>(events->getDropped());
+		data.append(s);
+	}
+	return data;
+}
+
+Json::Value IpcServer::query(const std::string &what) {
+	WindowManager *wm = WindowManager::getInstance();
+	Json::Value data(Json::arrayValue);
+	if (what == "groups") {
+		for (auto &group : wm->getGroups()) {
+			Json::Value g;
+			g["Name"] = group->getName();
+			g["Active"] = group->isActive();
+			g["Clients"] = static_cast<Json::UInt64>(group->getClients().size());
+			data.append(g);
+		}
+	} else if (what == "clients") {
+		for (auto &entry : wm->getClients()) {
+			const auto &client = entry.second;
+			if (!client)
+				continue;
+			Json::Value c;
+			c["Window"] = static_cast<Json::UInt64>(client->getWindow());
+			c["Frame"] = static_cast<Json::UInt64>(client->getFrame());
+			c["Title"] = client->getTitle();
+			c["Class"] = client->getClass();
+			c["Group"] = client->getGroup() ? client->getGroup()->getName() : "";
+			c["Mapped"] = client->isMapped();
+			c["Focused"] = client->getWindow() == wm->getActiveWindow();
+			data.append(c);
+		}
+	} else if (what == "tree") {
+		std::vector<ClientRect> rects;
+		for (auto &group : wm->getGroups()) {
+			Json::Value g;
+			g["Name"] = group->getName();
+			g["Clients"] = Json::Value(Json::arrayValue);
+			group->getLayoutManager()->solve(rects);
+			for (const auto &rect : rects) {
+				Json::Value r;
+				r["Window"] = static_cast<Json::UInt64>(rect.client->getWindow());
+				r["X"] = rect.x;
+				r["Y"] = rect.y;
+				r["Width"] = rect.width;
+				r["Height"] = rect.height;
+				g["Clients"].append(r);
+			}
+			data.append(g);
+		}
+	} else {
+		throw std::runtime_error("unknown query: " + what);
+	}
+	return data;
+}
@@ -26,6 +26,10 @@
  *
  */
 #include "Layouts/LayoutManager.hpp"
+#include <algorithm>
+int LayoutManager::batchDepth_ = 0;
+std::vector<LayoutManager *> LayoutManager::batchedLayouts_;
+std::function<void(const LayoutManager *)> LayoutManager::commitListener_;
 LayoutManager::LayoutManager(Display *display,
 							 Window root,
 							 int size_x,
@@ -40,5 +44,84 @@ LayoutManager::LayoutManager(Display *display,
 	border_size_(borderSize),
 	gap_(gap),
 	screen_height_(0),
-	screen_width_(0) {}
+	screen_width_(0),
+	committed_(),
+	pending_(),
+	batched_(false) {}
+
+LayoutManager::~LayoutManager() {
+	if (batched_)
+		batchedLayouts_.erase(std::remove(batchedLayouts_.begin(), batchedLayouts_.end(), this),
+							  batchedLayouts_.end());
+}
+
+void LayoutManager::beginBatch() { batchDepth_++; }
+
+void LayoutManager::endBatch() {
+	if (batchDepth_ == 0 || --batchDepth_ > 0)
+		return;
+	std::vector<LayoutManager *> layouts;
+	layouts.swap(batchedLayouts_);
+	for (LayoutManager *layout : layouts) {
+		layout->batched_ = false;
+		layout->solve(layout->pending_);
+		layout->commit(layout->pending_);
+	}
+}
+
+void LayoutManager::commit(const std::vector<ClientRect> &rects) {
+	if (batchDepth_ > 0) {
+		if (!batched_) {
+			batched_ = true;
+			batchedLayouts_.push_back(this);
+		}
+		return;
+	}
+	for (const auto &rect : rects) {
+		if (rect.client->isFullscreen())
+			continue;
+		auto it = committed_.find(rect.client);
+		if (it == committed_.end()) {
+			rect.client->move(rect.x, rect.y);
+			rect.client->resize(rect.width, rect.height);
+			rect.client->restack();
+			committed_.emplace(rect.client, rect);
+			continue;
+		}
+		ClientRect &old = it->second;
+		if (old.x != rect.x || old.y != rect.y)
+			rect.client->move(rect.x, rect.y);
+		if (old.width != rect.width || old.height != rect.height)
+			rect.client->resize(rect.width, rect.height);
+		old = rect;
+	}
+	if (commitListener_)
+		commitListener_(this);
+}
+
+void LayoutManager::setCommitListener(std::function<void(const LayoutManager *)> listener) {
+	commitListener_ = std::move(listener);
+}
+
+void LayoutManager::forgetClient(Client *client) {
+	committed_.erase(client);
+}
+
+void LayoutManager::focusClient(Client *client) {}
+
+bool LayoutManager::isVisible(Client *client) const { return true; }
+
+void LayoutManager::relayout() {
+	solve(pending_);
+	commit(pending_);
+}
+
+void LayoutManager::setSpacing(int borderSize, int gap) {
+	if (borderSize == border_size_ && gap == gap_)
+		return;
+	border_size_ = borderSize;
+	gap_ = gap;
+	solve(pending_);
+	commit(pending_);
+}
 
@@ -26,35 +26,137 @@
  */
 
 #include "Layouts/MasterLayoutManager.hpp"
-#include "Layouts/MasterSpace.hpp"
+#include <algorithm>
 
-void MasterLayoutManager::removeClient(Client *client) {
+MasterLayoutManager::MasterLayoutManager(Display *display,
+										 Window root,
+										 int sizeX,
+										 int sizeY,
+										 int posX,
+										 int posY,
+										 int borderSize,
+										 int gap,
+										 int barHeight,
+										 bool vertical) :
+		LayoutManager(display,root,sizeX,sizeY,posX,posY,borderSize,gap),
+		pos_(posX, posY),
+		size_(sizeX - borderSize, sizeY - borderSize),
+		vertical_(vertical),
+		masterCount_(1),
+		ratio_(0.5),
+		master_(pos_, size_, vertical),
+		stack_(pos_, size_, vertical) {
+	updateColumns();
+}
+
+bool MasterLayoutManager::updateColumns() {
+	if (stack_.getClientCount() == 0) {
+		bool changed = master_.setGeometry(pos_, size_);
+		return stack_.setGeometry(pos_, Point(0, 0)) || changed;
+	}
+	unsigned int length = vertical_ ? size_.x : size_.y;
+	auto masterLength = static_cast<unsigned int>(length * ratio_);
+	Point masterSize = vertical_ ? Point(masterLength, size_.y) : Point(size_.x, masterLength);
+	Point stackSize = vertical_ ? Point(size_.x - masterLength, size_.y) : Point(size_.x, size_.y - masterLength);
+	Point stackPos = vertical_ ? Point(pos_.x + masterLength, pos_.y) : Point(pos_.x, pos_.y + masterLength);
+	bool changed = master_.setGeometry(pos_, masterSize);
+	return stack_.setGeometry(stackPos, stackSize) || changed;
+}
+
+void MasterLayoutManager::commitColumn(const MasterSpace &column) {
+	pending_.clear();
+	column.solve(border_size_, gap_, pending_);
+	commit(pending_);
+}
 
+void MasterLayoutManager::commitAll() {
+	solve(pending_);
+	commit(pending_);
+}
+
+void MasterLayoutManager::solve(std::vector<ClientRect> &rects) const {
+	rects.clear();
+	master_.solve(border_size_, gap_, rects);
+	stack_.solve(border_size_, gap_, rects);
 }
 
 void MasterLayoutManager::addClient(std::shared_ptr<Client> client) {
+	Client *c = client.get();
+	if (master_.hasClient(c) || stack_.hasClient(c))
+		return;
+	bool toMaster = master_.getClientCount() < static_cast<size_t>(masterCount_);
+	if (toMaster)
+		master_.insertClient(master_.getClientCount(), c);
+	else
+		stack_.insertClient(stack_.getClientCount(), c);
+	if (updateColumns())
+		commitAll();
+	else
+		commitColumn(toMaster ? master_ : stack_);
+}
 
+void MasterLayoutManager::removeClient(Client *client) {
+	forgetClient(client);
+	if (stack_.removeClient(client)) {
+		if (updateColumns())
+			commitAll();
+		else
+			commitColumn(stack_);
+		return;
+	}
+	if (!master_.removeClient(client))
+		return;
+	Client *promoted = stack_.takeFront();
+	if (promoted)
+		master_.insertClient(master_.getClientCount(), promoted);
+	if (updateColumns() || promoted)
+		commitAll();
+	else
+		commitColumn(master_);
 }
 
 void MasterLayoutManager::reSize(const Point &size, const Point &pos) {
-
+	pos_ = pos;
+	size_ = size;
+	updateColumns();
+	commitAll();
 }
 
 void MasterLayoutManager::updateGeometry(unsigned int sizeX, unsigned int sizeY, unsigned int posX, unsigned int posY) {
+	reSize(Point(sizeX, sizeY), Point(posX, posY));
+}
 
+void MasterLayoutManager::applyMasterCount(int count) {
+	masterCount_ = std::max(1, count);
+	while (master_.getClientCount() > static_cast<size_t>(masterCount_))
+		stack_.insertClient(0, master_.takeBack());
+	while (master_.getClientCount() < static_cast<size_t>(masterCount_) && stack_.getClientCount() > 0)
+		master_.insertClient(master_.getClientCount(), stack_.takeFront());
 }
 
-MasterLayoutManager::MasterLayoutManager(Display *display,
-										 Window root,
-										 int sizeX,
-										 int sizeY,
-										 int posX,
-										 int posY,
-										 int borderSize,
-										 int gap,
-										 int barHeight) :
-		LayoutManager(display,root,sizeX,sizeY,posX,posY,gap,barHeight) {
-	Point pos(posX, posY);
-	Point size(sizeX - borderSize, sizeY - borderSize);
-	this->rootSpace_ = std::make_unique<MasterSpace>(pos, size,0, true, true);
+void MasterLayoutManager::setMasterCount(int count) {
+	setParams(count, ratio_);
+}
+
+void MasterLayoutManager::setRatio(double ratio) {
+	setParams(masterCount_, ratio);
+}
+
+void MasterLayoutManager::setParams(int count, double ratio) {
+	applyMasterCount(count);
+	ratio_ = std::min(0.9, std::max(0.1, ratio));
+	updateColumns();
+	commitAll();
+}
+
+void MasterLayoutManager::growMaster(int inc) {
+	unsigned int length = vertical_ ? size_.x : size_.y;
+	if (length == 0)
+		return;
+	setRatio(ratio_ + static_cast<double>(inc) / length);
 }
+
+int MasterLayoutManager::getMasterCount() const { return masterCount_; }
+double MasterLayoutManager::getRatio() const { return ratio_; }
+const MasterSpace &MasterLayoutManager::getMasterSpace() const { return master_; }
+const MasterSpace &MasterLayoutManager::getStackSpace() const { return stack_; }
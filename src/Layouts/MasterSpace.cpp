@@ -25,40 +25,76 @@
  * @date 2024-03-21
  */
 #include "Layouts/MasterSpace.hpp"
+#include <algorithm>
 
 MasterSpace::MasterSpace(Point pos,
 						 Point size,
-						 int index,
-						 bool master,
-						 bool vertical,
-						 MasterSpace *parent) :
+						 bool vertical) :
 	pos_(pos),
 	size_(size),
-	index_(index),
-	is_master_(master),
 	is_vertical_(vertical),
-	subspace_count_(0){
-	if (parent) {
-		parent_ = parent;
-	}
-}
+	clients_() {}
 MasterSpace::~MasterSpace() = default;
 const Point &MasterSpace::getPos() const { return pos_; }
 void MasterSpace::setPos(const Point &pos) { pos_ = pos; }
 const Point &MasterSpace::getSize() const { return size_; }
 void MasterSpace::setSize(const Point &size) { size_ = size; }
-bool MasterSpace::isMaster() const { return is_master_; }
-void MasterSpace::setIsMaster(bool isMaster) { is_master_ = isMaster; }
 bool MasterSpace::isVertical() const { return is_vertical_; }
 void MasterSpace::setIsVertical(bool isVertical) { is_vertical_ = isVertical; }
-int MasterSpace::getIndex() const { return index_; }
-void MasterSpace::setIndex(int index) { index_ = index; }
-int MasterSpace::getSubspaceCount() const { return subspace_count_; }
-void MasterSpace::setSubspaceCount(int subspaceCount) { subspace_count_ = subspaceCount; }
-MasterSpace *MasterSpace::getParent() const { return parent_; }
-void MasterSpace::setParent(MasterSpace *parent) { parent_ = parent; }
-MasterSpace *MasterSpace::getMaster() const { return master_.get(); }
-void MasterSpace::setMaster(std::unique_ptr<MasterSpace> master) { master_ = std::move(master); }
-const std::vector<std::unique_ptr<MasterSpace>> &MasterSpace::getSlaves() const { return slaves_; }
-const std::weak_ptr<Client> &MasterSpace::getClient() const { return client_; }
-void MasterSpace::setClient(const std::weak_ptr<Client> &client) { client_ = client; }
\ No newline at end of file
+bool MasterSpace::setGeometry(const Point &pos, const Point &size) {
+	if (pos.x == pos_.x && pos.y == pos_.y && size.x == size_.x && size.y == size_.y)
+		return false;
+	pos_ = pos;
+	size_ = size;
+	return true;
+}
+const std::vector<Client *> &MasterSpace::getClients() const { return clients_; }
+size_t MasterSpace::getClientCount() const { return clients_.size(); }
+bool MasterSpace::hasClient(Client *client) const {
+	return std::find(clients_.begin(), clients_.end(), client) != clients_.end();
+}
+void MasterSpace::insertClient(size_t index, Client *client) {
+	if (index > clients_.size())
+		index = clients_.size();
+	clients_.insert(clients_.begin() + static_cast<long>(index), client);
+}
+bool MasterSpace::removeClient(Client *client) {
+	auto it = std::find(clients_.begin(), clients_.end(), client);
+	if (it == clients_.end())
+		return false;
+	clients_.erase(it);
+	return true;
+}
+Client *MasterSpace::takeFront() {
+	if (clients_.empty())
+		return nullptr;
+	Client *client = clients_.front();
+	clients_.erase(clients_.begin());
+	return client;
+}
+Client *MasterSpace::takeBack() {
+	if (clients_.empty())
+		return nullptr;
+	Client *client = clients_.back();
+	clients_.pop_back();
+	return client;
+}
+void MasterSpace::solve(int borderSize, int gap, std::vector<ClientRect> &rects) const {
+	if (clients_.empty())
+		return;
+	auto count = static_cast<unsigned int>(clients_.size());
+	unsigned int length = is_vertical_ ? size_.y : size_.x;
+	unsigned int share = length / count;
+	unsigned int offset = 0;
+	for (unsigned int i = 0; i < count; i++) {
+		unsigned int current = (i == count - 1) ? length - offset : share;
+		Point pos = is_vertical_ ? Point(pos_.x, pos_.y + offset) : Point(pos_.x + offset, pos_.y);
+		Point size = is_vertical_ ? Point(size_.x, current) : Point(current, size_.y);
+		rects.push_back({clients_[i],
+						 static_cast<int>(pos.x) + borderSize + gap / 2,
+						 static_cast<int>(pos.y) + borderSize + gap / 2,
+						 size.x - (borderSize * 2) - gap,
+						 size.y - (borderSize * 2) - gap});
+		offset += current;
+	}
+}
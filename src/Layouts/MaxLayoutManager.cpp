@@ -0,0 +1,122 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file MaxLayoutManager.cpp
+ * @brief MaxLayoutManager class implementation.
+ * @date 2026-10-19
+ */
+
+#include "Layouts/MaxLayoutManager.hpp"
+#include "Group.hpp"
+#include <algorithm>
+
+MaxLayoutManager::MaxLayoutManager(Display *display,
+								   Window root,
+								   int sizeX,
+								   int sizeY,
+								   int posX,
+								   int posY,
+								   int borderSize,
+								   int gap,
+								   int barHeight) :
+	LayoutManager(display, root, sizeX, sizeY, posX, posY, borderSize, gap),
+	pos_(posX, posY),
+	size_(sizeX - borderSize, sizeY - borderSize),
+	clients_(),
+	visible_(nullptr) {}
+
+void MaxLayoutManager::updateGeometry(unsigned int sizeX, unsigned int sizeY, unsigned int posX, unsigned int posY) {
+	reSize(Point(sizeX, sizeY), Point(posX, posY));
+}
+
+void MaxLayoutManager::reSize(const Point &size, const Point &pos) {
+	pos_ = pos;
+	size_ = size;
+	solve(pending_);
+	commit(pending_);
+}
+
+void MaxLayoutManager::addClient(std::shared_ptr<Client> client) {
+	Client *c = client.get();
+	if (std::find(clients_.begin(), clients_.end(), c) != clients_.end())
+		return;
+	clients_.push_back(c);
+	focusClient(c);
+}
+
+void MaxLayoutManager::removeClient(Client *client) {
+	forgetClient(client);
+	auto it = std::find(clients_.begin(), clients_.end(), client);
+	if (it == clients_.end())
+		return;
+	size_t index = it - clients_.begin();
+	clients_.erase(it);
+	if (visible_ != client)
+		return;
+	visible_ = nullptr;
+	if (clients_.empty())
+		return;
+	focusClient(clients_[index == 0 ? 0 : index - 1]);
+}
+
+void MaxLayoutManager::solve(std::vector<ClientRect> &rects) const {
+	rects.clear();
+	if (visible_ == nullptr)
+		return;
+	rects.push_back({visible_,
+					 static_cast<int>(pos_.x) + border_size_ + gap_ / 2,
+					 static_cast<int>(pos_.y) + border_size_ + gap_ / 2,
+					 size_.x - (border_size_ * 2) - gap_,
+					 size_.y - (border_size_ * 2) - gap_});
+}
+
+void MaxLayoutManager::focusClient(Client *client) {
+	if (client == visible_)
+		return;
+	if (std::find(clients_.begin(), clients_.end(), client) == clients_.end())
+		return;
+	if (visible_ != nullptr)
+		visible_->setVisible(false);
+	visible_ = client;
+	solve(pending_);
+	commit(pending_);
+	// a hidden group maps its visible client when Group::show() is called
+	auto group = visible_->getGroup();
+	if (group && !group->isActive())
+		return;
+	visible_->setVisible(true);
+	visible_->restack();
+}
+
+bool MaxLayoutManager::isVisible(Client *client) const { return client == visible_; }
+
+Client *MaxLayoutManager::nextClient(int step) const {
+	if (clients_.empty())
+		return nullptr;
+	auto count = static_cast<long>(clients_.size());
+	auto it = std::find(clients_.begin(), clients_.end(), visible_);
+	long index = it == clients_.end() ? 0 : it - clients_.begin();
+	index = ((index + step) % count + count) % count;
+	return clients_[index];
+}
+
+Client *MaxLayoutManager::getVisibleClient() const { return visible_; }
@@ -35,205 +35,249 @@ TreeLayoutManager::TreeLayoutManager(Display *display,
 									 int borderSize,
 									 int gap,
 									 int barHeight) :
-	LayoutManager(display, root, sizeX, sizeY, posX, posY, gap, barHeight) {
+	LayoutManager(display, root, sizeX, sizeY, posX, posY, borderSize, gap),
+	rootSpace_(NO_SPACE) {
 	Point pos(posX, posY);
 	Point size(sizeX - borderSize, sizeY - borderSize);
-	this->rootSpace_ = std::make_unique<BinarySpace>(pos, size, 0);
+	rootSpace_ = allocSpace(pos, size, NO_SPACE);
 }
-void TreeLayoutManager::deleteSpace(BinarySpace *space) {
-	if (space->getLeft() != nullptr) {
-		deleteSpace(space->getLeft().get());
-	}
-	if (space->getRight() != nullptr) {
-		deleteSpace(space->getRight().get());
+TreeLayoutManager::~TreeLayoutManager() {}
+SpaceIndex TreeLayoutManager::allocSpace(const Point &pos, const Point &size, SpaceIndex parent) {
+	if (!freeSpaces_.empty()) {
+		SpaceIndex index = freeSpaces_.back();
+		freeSpaces_.pop_back();
+		spaces_[index] = BinarySpace(pos, size, index, parent);
+		return index;
 	}
-	delete space;
+	auto index = static_cast<SpaceIndex>(spaces_.size());
+	spaces_.emplace_back(pos, size, index, parent);
+	return index;
 }
-TreeLayoutManager::~TreeLayoutManager() {}
-void TreeLayoutManager::updateGeometry(unsigned int sizeX, unsigned int sizeY, unsigned int posX, unsigned int posY) {
-	reSize(Point(sizeX,sizeY),Point(posX,posY));
+void TreeLayoutManager::freeSpace(SpaceIndex space) {
+	spaces_[space] = BinarySpace(Point(), Point(), space);
+	freeSpaces_.push_back(space);
 }
-BinarySpace * TreeLayoutManager::findSpaceRecursive(Client *client,
-													BinarySpace * space) {
-	if (space->getClient().get() == client) {
-		return space;
-	}
-	if (space->getLeft() != nullptr) {
-		BinarySpace * leftSpace = findSpaceRecursive(client, space->getLeft().get());
-		if (leftSpace != nullptr) {
-			return leftSpace;
-		}
-	}
-	if (space->getRight() != nullptr) {
-		BinarySpace * rightSpace = findSpaceRecursive(client, space->getRight().get());
-		if (rightSpace != nullptr) {
-			return rightSpace;
-		}
+ClientHandle TreeLayoutManager::acquireClient(const std::shared_ptr<Client> &client) {
+	ClientHandle handle;
+	if (!freeClients_.empty()) {
+		handle = freeClients_.back();
+		freeClients_.pop_back();
+		clientSlots_[handle] = {client, client.get(), NO_SPACE};
+	} else {
+		handle = static_cast<ClientHandle>(clientSlots_.size());
+		clientSlots_.push_back({client, client.get(), NO_SPACE});
 	}
-	return nullptr;
+	clientIndex_[client.get()] = handle;
+	return handle;
+}
+void TreeLayoutManager::releaseClient(ClientHandle client) {
+	clientIndex_.erase(clientSlots_[client].raw);
+	clientSlots_[client] = {std::weak_ptr<Client>(), nullptr, NO_SPACE};
+	freeClients_.push_back(client);
+}
+std::shared_ptr<Client> TreeLayoutManager::getClient(ClientHandle handle) const {
+	if (handle == NO_CLIENT || handle >= clientSlots_.size())
+		return nullptr;
+	return clientSlots_[handle].client.lock();
 }
-BinarySpace * TreeLayoutManager::findSpace(Client *client) {
-	BinarySpace* space = rootSpace_.get();
-	return findSpaceRecursive(client, space);
+const BinarySpace &TreeLayoutManager::getSpace(SpaceIndex index) const { return spaces_.at(index); }
+SpaceIndex TreeLayoutManager::getRootSpace() const { return rootSpace_; }
+size_t TreeLayoutManager::getPoolSize() const { return spaces_.size(); }
+void TreeLayoutManager::updateGeometry(unsigned int sizeX, unsigned int sizeY, unsigned int posX, unsigned int posY) {
+	reSize(Point(sizeX,sizeY),Point(posX,posY));
 }
-BinarySpace * TreeLayoutManager::findSpace(int index) {
-	return nullptr;
+SpaceIndex TreeLayoutManager::findSpace(Client *client) const {
+	auto it = clientIndex_.find(client);
+	if (it == clientIndex_.end())
+		return NO_SPACE;
+	return clientSlots_[it->second].space;
 }
 void TreeLayoutManager::removeClient(Client* client) {
-	removeClientRecursive(client, rootSpace_.get());
-}
-void TreeLayoutManager::removeClientRecursive(Client* client, BinarySpace* space) {
-	if (space->getClient().get() == client) {
-		space->setClient(nullptr);
-		if (space != rootSpace_.get()) {
-			bool isLeftChild = (space->getParent()->getLeft().get() == space);
-			BinarySpace* siblingSpace = isLeftChild ? space->getParent()->getRight().get() : space->getParent()->getLeft().get();
-			if (siblingSpace->getClient() != nullptr) {
-				placeClientInSpace(siblingSpace->getClient(), space->getParent());
-				siblingSpace->setClient(nullptr);
-			}
-			if (isLeftChild) {
-				space->getParent()->setLeft(nullptr);
-			} else {
-				space->getParent()->setRight(nullptr);
-			}
-		}
+	auto it = clientIndex_.find(client);
+	if (it == clientIndex_.end())
 		return;
+	ClientHandle handle = it->second;
+	removeClientFromSpace(handle, clientSlots_[handle].space);
+}
+void TreeLayoutManager::removeClientFromSpace(ClientHandle client, SpaceIndex space) {
+	spaces_[space].setClient(NO_CLIENT);
+	forgetClient(clientSlots_[client].raw);
+	releaseClient(client);
+	if (space == rootSpace_)
+		return;
+	SpaceIndex parent = spaces_[space].getParent();
+	bool isLeftChild = (spaces_[parent].getLeft() == space);
+	SpaceIndex siblingSpace = isLeftChild ? spaces_[parent].getRight() : spaces_[parent].getLeft();
+	const BinarySpace &sibling = spaces_[siblingSpace];
+	BinarySpace &p = spaces_[parent];
+	p.setLeft(sibling.getLeft());
+	p.setRight(sibling.getRight());
+	p.setSplitAlongX(sibling.isSplitAlongX());
+	p.setSubspaceCount(sibling.getSubspaceCount());
+	p.setClient(NO_CLIENT);
+	if (sibling.getClient() != NO_CLIENT)
+		placeClientInSpace(sibling.getClient(), parent);
+	if (p.getLeft() != NO_SPACE)
+		spaces_[p.getLeft()].setParent(parent);
+	if (p.getRight() != NO_SPACE)
+		spaces_[p.getRight()].setParent(parent);
+	freeSpace(space);
+	freeSpace(siblingSpace);
+	for (SpaceIndex a = spaces_[parent].getParent(); a != NO_SPACE; a = spaces_[a].getParent()) {
+		spaces_[a].decSubSpaceCount();
 	}
-	if (space->getLeft() != nullptr) {
-		removeClientRecursive(client, space->getLeft().get());
-	}
-	if (space->getRight() != nullptr) {
-		removeClientRecursive(client, space->getRight().get());
-	}
+	Point size = spaces_[parent].getSize();
+	Point pos = spaces_[parent].getPos();
+	recursiveResize(size, pos, parent);
+	commitSubtree(parent);
 }
 void TreeLayoutManager::addClient(std::shared_ptr<Client> client) {
-	addClientRecursive(client, rootSpace_.get());
+	if (clientIndex_.find(client.get()) != clientIndex_.end())
+		return;
+	commitSubtree(addClientRecursive(acquireClient(client), rootSpace_));
 }
-void TreeLayoutManager::addClientRecursive(std::shared_ptr<Client> client, BinarySpace* space) {
-	if (space->getClient() == nullptr && space->getLeft() == nullptr && space->getRight() == nullptr ) {
+SpaceIndex TreeLayoutManager::addClientRecursive(ClientHandle client, SpaceIndex space) {
+	const BinarySpace &s = spaces_[space];
+	if (s.getClient() == NO_CLIENT && s.getLeft() == NO_SPACE && s.getRight() == NO_SPACE) {
 		placeClientInSpace(client, space);
-		return;
+		return space;
 	}
-	if (space->getLeft() != nullptr && space->getRight() != nullptr) {
-		if (space->getLeft()->getSubspaceCount() > space->getRight()->getSubspaceCount()) {
-			addClientRecursive(client, space->getRight().get());
+	if (s.getLeft() != NO_SPACE && s.getRight() != NO_SPACE) {
+		if (spaces_[s.getLeft()].getSubspaceCount() > spaces_[s.getRight()].getSubspaceCount()) {
+			return addClientRecursive(client, s.getRight());
 		} else {
-			addClientRecursive(client, space->getLeft().get());
+			return addClientRecursive(client, s.getLeft());
 		}
-		return;
 	}
-	if (space->getSize().x > space->getSize().y) {
-		splitSpace(client, space, true);
-	} else {
-		splitSpace(client, space, false);
+	splitSpace(client, space, s.getSize().x > s.getSize().y);
+	return space;
+}
+void TreeLayoutManager::placeClientInSpace(ClientHandle client, SpaceIndex space) {
+	spaces_[space].setClient(client);
+	clientSlots_[client].space = space;
+}
+ClientRect TreeLayoutManager::clientRect(ClientHandle client, const BinarySpace &space) const {
+	return {clientSlots_[client].raw,
+			static_cast<int>(space.getPos().x) + border_size_ + gap_ / 2,
+			static_cast<int>(space.getPos().y) + border_size_ + gap_ / 2,
+			space.getSize().x - (border_size_ * 2) - gap_,
+			space.getSize().y - (border_size_ * 2) - gap_};
+}
+void TreeLayoutManager::solve(std::vector<ClientRect> &rects) const {
+	rects.clear();
+	solveSubtree(rootSpace_, rects);
+}
+void TreeLayoutManager::solveSubtree(SpaceIndex space, std::vector<ClientRect> &rects) const {
+	const BinarySpace &s = spaces_[space];
+	if (s.getClient() != NO_CLIENT) {
+		rects.push_back(clientRect(s.getClient(), s));
+		return;
 	}
+	if (s.getLeft() != NO_SPACE)
+		solveSubtree(s.getLeft(), rects);
+	if (s.getRight() != NO_SPACE)
+		solveSubtree(s.getRight(), rects);
 }
-void TreeLayoutManager::placeClientInSpace(const std::shared_ptr<Client>& client, BinarySpace* space) {
-	client->move(static_cast<int>(space->getPos().x) + border_size_ + gap_ / 2,static_cast<int>(space->getPos().y) + border_size_ + gap_ / 2);
-	client->resize(space->getSize().x - (border_size_ * 2)- gap_, space->getSize().y - (border_size_ * 2) - gap_);
-	client->restack();
-	if (space->getClient().get() != client.get())
-		space->setClient(client);
+void TreeLayoutManager::commitSubtree(SpaceIndex space) {
+	pending_.clear();
+	solveSubtree(space, pending_);
+	commit(pending_);
 }
-void TreeLayoutManager::splitSpace(const std::shared_ptr<Client>& client, BinarySpace* space, bool splitAlongX) {
+void TreeLayoutManager::splitSpace(ClientHandle client, SpaceIndex space, bool splitAlongX) {
+	Point pos = spaces_[space].getPos();
+	Point size = spaces_[space].getSize();
 	Point sizeLeft, sizeRight;
 	Point posRight;
 	if (splitAlongX) {
-		sizeLeft = Point(space->getSize().x / 2, space->getSize().y);
-		sizeRight = Point(space->getSize().x - sizeLeft.x, space->getSize().y);
-		posRight = Point(space->getPos().x + sizeLeft.x, space->getPos().y);
+		sizeLeft = Point(size.x / 2, size.y);
+		sizeRight = Point(size.x - sizeLeft.x, size.y);
+		posRight = Point(pos.x + sizeLeft.x, pos.y);
 	} else {
-		sizeLeft = Point(space->getSize().x, space->getSize().y / 2);
-		sizeRight = Point(space->getSize().x, space->getSize().y - sizeLeft.y);
-		posRight = Point(space->getPos().x, space->getPos().y + sizeLeft.y);
+		sizeLeft = Point(size.x, size.y / 2);
+		sizeRight = Point(size.x, size.y - sizeLeft.y);
+		posRight = Point(pos.x, pos.y + sizeLeft.y);
 	}
-	auto leftSpace = std::make_unique<BinarySpace>(space->getPos(), sizeLeft, space_count_++, space);
-	auto rightSpace = std::make_unique<BinarySpace>(posRight, sizeRight, space_count_++, space);
-	placeClientInSpace(space->getClient(), leftSpace.get());
-	placeClientInSpace(client, rightSpace.get());
-	space->setLeft(std::move(leftSpace));
-	space->setRight(std::move(rightSpace));
-	space->setClient(nullptr);
-	space->incSubSpaceCount();
-	while(space->getParent() != nullptr) {
-		space->getParent()->incSubSpaceCount();
-		space = space->getParent();
+	SpaceIndex leftSpace = allocSpace(pos, sizeLeft, space);
+	SpaceIndex rightSpace = allocSpace(posRight, sizeRight, space);
+	ClientHandle oldClient = spaces_[space].getClient();
+	if (oldClient != NO_CLIENT)
+		placeClientInSpace(oldClient, leftSpace);
+	placeClientInSpace(client, rightSpace);
+	BinarySpace &s = spaces_[space];
+	s.setLeft(leftSpace);
+	s.setRight(rightSpace);
+	s.setClient(NO_CLIENT);
+	s.setSplitAlongX(splitAlongX);
+	s.incSubSpaceCount();
+	for (SpaceIndex p = s.getParent(); p != NO_SPACE; p = spaces_[p].getParent()) {
+		spaces_[p].incSubSpaceCount();
 	}
 }
 
 void TreeLayoutManager::growSpace(Client *client, int inc) {
-	BinarySpace *space = findSpace(client);
-	if (space == nullptr || space == rootSpace_.get()) {
+	SpaceIndex space = findSpace(client);
+	if (space == NO_SPACE || space == rootSpace_) {
 		return;
 	}
-	bool isLeftChild = (space->getParent()->getLeft().get() == space);
-	int dx = std::abs((int)space->getSize().x - (int)space->getParent()->getSize().x);
-	int dy = std::abs((int)space->getSize().y - (int)space->getParent()->getSize().y);
-	bool vertical;
-	if (std::max(dx, dy) == dx) {
-		vertical = false;
-	} else {
-		vertical = true;
-	}
-	BinarySpace *siblingSpace = isLeftChild ? space->getParent()->getRight().get()
-											: space->getParent()->getLeft().get();
-	space->setSize(vertical ? Point(space->getSize().x, space->getSize().y + inc) : Point(space->getSize().x + inc,
-																						  space->getSize().y));
+	SpaceIndex parent = spaces_[space].getParent();
+	bool isLeftChild = (spaces_[parent].getLeft() == space);
+	bool vertical = !spaces_[parent].isSplitAlongX();
+	SpaceIndex siblingSpace = isLeftChild ? spaces_[parent].getRight()
+										  : spaces_[parent].getLeft();
+	if (siblingSpace == NO_SPACE)
+		return;
+	BinarySpace &s = spaces_[space];
+	BinarySpace &sibling = spaces_[siblingSpace];
+	s.setSize(vertical ? Point(s.getSize().x, s.getSize().y + inc) : Point(s.getSize().x + inc,
+																			s.getSize().y));
 	if (!isLeftChild) {
-		space->setPos(vertical ? Point(space->getPos().x, space->getPos().y - inc) : Point(space->getPos().x - inc,
-																						  space->getPos().y));
+		s.setPos(vertical ? Point(s.getPos().x, s.getPos().y - inc) : Point(s.getPos().x - inc,
+																			s.getPos().y));
 	} else {
-		siblingSpace->setPos(vertical ? Point(siblingSpace->getPos().x, siblingSpace->getPos().y + inc) : Point(
-				siblingSpace->getPos().x + inc, siblingSpace->getPos().y));
+		sibling.setPos(vertical ? Point(sibling.getPos().x, sibling.getPos().y + inc) : Point(
+				sibling.getPos().x + inc, sibling.getPos().y));
 	}
-	if (space->getClient() != nullptr) {
-		placeClientInSpace(space->getClient(), space);
-	}
-	siblingSpace->setSize(vertical ? Point(siblingSpace->getSize().x, siblingSpace->getSize().y - inc) : Point(
-			siblingSpace->getSize().x - inc, siblingSpace->getSize().y));
-	if (siblingSpace->getClient() != nullptr) {
-		placeClientInSpace(siblingSpace->getClient(), siblingSpace);
-	} else {
+	sibling.setSize(vertical ? Point(sibling.getSize().x, sibling.getSize().y - inc) : Point(
+			sibling.getSize().x - inc, sibling.getSize().y));
+	if (sibling.getClient() == NO_CLIENT) {
 		recursiveShrinkSiblingSpace(siblingSpace, inc, vertical);
 	}
+	commitSubtree(parent);
 }
-void TreeLayoutManager::recursiveShrinkSiblingSpace(BinarySpace *space, int inc, bool vertical) {
-	if (space->getLeft() != nullptr) {
-		recursiveShrinkSiblingSpace(space->getLeft().get(), inc, vertical);
+void TreeLayoutManager::recursiveShrinkSiblingSpace(SpaceIndex space, int inc, bool vertical) {
+	BinarySpace &s = spaces_[space];
+	if (s.getLeft() != NO_SPACE) {
+		recursiveShrinkSiblingSpace(s.getLeft(), inc, vertical);
 	}
-	if (space->getRight() != nullptr) {
-		recursiveShrinkSiblingSpace(space->getRight().get(), inc, vertical);
-	}
-	space->setSize(vertical ? Point(space->getSize().x, space->getSize().y - inc) : Point(space->getSize().x - inc,
-																						  space->getSize().y));
-	if (space->getClient() != nullptr) {
-		placeClientInSpace(space->getClient(), space);
+	if (s.getRight() != NO_SPACE) {
+		recursiveShrinkSiblingSpace(s.getRight(), inc, vertical);
 	}
+	s.setSize(vertical ? Point(s.getSize().x, s.getSize().y - inc) : Point(s.getSize().x - inc,
+																			s.getSize().y));
 }
 void TreeLayoutManager::reSize(const Point &size,
 							   const Point &pos) {
-	if (rootSpace_->getSize().x == size.x && rootSpace_->getSize().y == size.y) {
+	const BinarySpace &root = spaces_[rootSpace_];
+	if (root.getSize().x == size.x && root.getSize().y == size.y
+		&& root.getPos().x == pos.x && root.getPos().y == pos.y) {
 		return;
 	}
-	recursiveResize(size, pos,rootSpace_.get());
+	recursiveResize(size, pos, rootSpace_);
+	commitSubtree(rootSpace_);
 }
 
 void TreeLayoutManager::recursiveResize(const Point &size,
 										const Point &pos,
-										BinarySpace * space) {
-	Point oldSize = space->getSize();
-	space->setSize(size);
-	space->setPos(pos);
-	if (space->getClient() != nullptr) {
-		placeClientInSpace(space->getClient(), space);
-	}
-	if (space->getLeft() != nullptr) {
+										SpaceIndex space) {
+	BinarySpace &s = spaces_[space];
+	s.setSize(size);
+	s.setPos(pos);
+	if (s.getLeft() != NO_SPACE && s.getRight() != NO_SPACE) {
 		Point leftPos = pos;
 		Point leftSize = size;
 		Point rightPos = pos;
 		Point rightSize = size;
-		if (space->getLeft()->getSize().x == oldSize.x) {
+		if (!s.isSplitAlongX()) {
 			leftSize.y = size.y / 2;
 			rightSize.y = size.y - leftSize.y;
 			rightPos.y = pos.y + leftSize.y;
@@ -242,9 +286,7 @@ void TreeLayoutManager::recursiveResize(const Point &size,
 			rightSize.x = size.x - leftSize.x;
 			rightPos.x = pos.x + leftSize.x;
 		}
-		recursiveResize(leftSize, leftPos, space->getLeft().get());
-		recursiveResize(rightSize, rightPos, space->getRight().get());
-	} 
+		recursiveResize(leftSize, leftPos, s.getLeft());
+		recursiveResize(rightSize, rightPos, s.getRight());
+	}
 }
-
-
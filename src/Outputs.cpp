@@ -0,0 +1,104 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file Outputs.cpp
+ * @brief Outputs class implementation.
+ * @date 2026-10-19
+ */
+#include "Outputs.hpp"
+#include <algorithm>
+
+const size_t Outputs::none = static_cast<size_t>(-1);
+
+Outputs::Outputs() : outputs_(), focused_(0) {}
+
+std::vector<size_t> Outputs::update(const std::vector<OutputGeometry> &geometries, std::vector<size_t> &released) {
+	std::vector<size_t> changed;
+	std::vector<Output> outputs;
+	std::vector<bool> kept(outputs_.size(), false);
+	size_t focused = none;
+	for (const auto &geometry : geometries) {
+		auto it = std::find_if(outputs_.begin(), outputs_.end(),
+							   [&](const Output &o) { return o.geometry.name == geometry.name; });
+		if (it == outputs_.end()) {
+			changed.push_back(outputs.size());
+			outputs.push_back({geometry, OutputGeometry(), none});
+			continue;
+		}
+		size_t previous = it - outputs_.begin();
+		kept[previous] = true;
+		if (previous == focused_)
+			focused = outputs.size();
+		if (it->geometry != geometry)
+			changed.push_back(outputs.size());
+		outputs.push_back({geometry, it->area, it->group});
+	}
+	for (size_t i = 0; i < outputs_.size(); i++) {
+		if (!kept[i] && outputs_[i].group != none)
+			released.push_back(outputs_[i].group);
+	}
+	outputs_.swap(outputs);
+	focused_ = focused != none ? focused : 0;
+	return changed;
+}
+
+bool Outputs::setArea(size_t output, const WorkArea &workArea) {
+	Output &o = outputs_.at(output);
+	int left = std::max(o.geometry.x, workArea.getX());
+	int top = std::max(o.geometry.y, workArea.getY());
+	int right = std::min(o.geometry.x + static_cast<int>(o.geometry.width),
+						 workArea.getX() + static_cast<int>(workArea.getWidth()));
+	int bottom = std::min(o.geometry.y + static_cast<int>(o.geometry.height),
+						  workArea.getY() + static_cast<int>(workArea.getHeight()));
+	OutputGeometry area = o.geometry;
+	// an output entirely covered by docks keeps its whole geometry
+	if (right > left && bottom > top) {
+		area.x = left;
+		area.y = top;
+		area.width = static_cast<unsigned int>(right - left);
+		area.height = static_cast<unsigned int>(bottom - top);
+	}
+	if (area == o.area)
+		return false;
+	o.area = area;
+	return true;
+}
+
+size_t Outputs::size() const { return outputs_.size(); }
+const OutputGeometry &Outputs::getGeometry(size_t output) const { return outputs_.at(output).geometry; }
+const OutputGeometry &Outputs::getArea(size_t output) const { return outputs_.at(output).area; }
+size_t Outputs::getGroup(size_t output) const { return outputs_.at(output).group; }
+void Outputs::setGroup(size_t output, size_t group) { outputs_.at(output).group = group; }
+
+size_t Outputs::find(size_t group) const {
+	for (size_t i = 0; i < outputs_.size(); i++) {
+		if (outputs_[i].group == group)
+			return i;
+	}
+	return none;
+}
+
+size_t Outputs::getFocused() const { return focused_; }
+void Outputs::setFocused(size_t output) {
+	if (output < outputs_.size())
+		focused_ = output;
+}
@@ -40,6 +40,14 @@ extern "C" {
 #include "Ewmh.hpp"
 #include "X11wrapper/baseX11Wrapper.hpp"
 #include "YggdrasilExceptions.hpp"
+#include "Commands/Spawn.hpp"
+#include "Ipc/IpcServer.hpp"
+#include <algorithm>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/timerfd.h>
+#include <cstring>
+#include <cerrno>
 bool WindowManager::wmDetected;
 WindowManager * WindowManager::instance_ = nullptr;
 void WindowManager::create(std::shared_ptr<BaseX11Wrapper> wrapper,const std::string &displayStr) {
@@ -62,35 +70,119 @@ WindowManager::WindowManager(Display *display, const std::shared_ptr<BaseX11Wrap
 		  root_(DefaultRootWindow(display)),
 		  WM_PROTOCOLS( wrapper->internAtom(display_, "WM_PROTOCOLS", false)),
 		  WM_DELETE_WINDOW(wrapper->internAtom(display_, "WM_DELETE_WINDOW", false)),
+		  NET_WM_STRUT(wrapper->internAtom(display_, "_NET_WM_STRUT", false)),
+		  NET_WM_STRUT_PARTIAL(wrapper->internAtom(display_, "_NET_WM_STRUT_PARTIAL", false)),
+		  NET_WM_WINDOW_TYPE(wrapper->internAtom(display_, "_NET_WM_WINDOW_TYPE", false)),
+		  NET_WM_WINDOW_TYPE_DOCK(wrapper->internAtom(display_, "_NET_WM_WINDOW_TYPE_DOCK", false)),
+		  NET_WM_PING(wrapper->internAtom(display_, "_NET_WM_PING", false)),
+		  workArea_(0, 0),
+		  outputs_(),
+		  screenChangeEvent_(-1),
 		  running(true),
 		  tsData(nullptr),
+		  groupsChannel(0),
+		  activeGroupChannel(0),
+		  evCountChannel(0),
 		  geometryX(0),
 		  geometryY(0),
 		  activeWindow(0),
-		  x11Wrapper(wrapper){}
+		  x11Wrapper(wrapper),
+		  watchedFds_(),
+		  ipcServer_(),
+		  clientList_(),
+		  stackingList_(),
+		  clientListDirty_(false),
+		  pingTimerFd_(-1),
+		  pingTimestamp_(0),
+		  hungChannel(0),
+		  childSignalFd_(-1),
+		  focusFollowsMouse_(false),
+		  focusTimerFd_(-1),
+		  pendingFocus_(None),
+		  crossingSerial_(0) {
+	Client::setProtocolAtoms(WM_PROTOCOLS, WM_DELETE_WINDOW, NET_WM_PING);
+}
 WindowManager::~WindowManager() {
+	LayoutManager::setCommitListener(nullptr);
+	ipcServer_.reset();
 	clients_.clear();
 	groups_.clear();
+	if (childSignalFd_ >= 0)
+		close(childSignalFd_);
+	if (pingTimerFd_ >= 0)
+		close(pingTimerFd_);
+	if (focusTimerFd_ >= 0)
+		close(focusTimerFd_);
 	Logger::GetInstance()->Log("WindowManager destroyed", L_INFO);
 }
 void WindowManager::init() {
+	childSignalFd_ = Spawn::openChildSignalFd();
+	if (childSignalFd_ >= 0) {
+		int fd = childSignalFd_;
+		watchFd(fd, [fd]() { Spawn::reapChildren(fd); });
+	}
+	pingTimerFd_ = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+	if (pingTimerFd_ >= 0) {
+		itimerspec period{};
+		period.it_interval.tv_sec = pingInterval;
+		period.it_value.tv_sec = pingInterval;
+		timerfd_settime(pingTimerFd_, 0, &period, nullptr);
+		watchFd(pingTimerFd_, [this]() {
+			uint64_t expirations;
+			while (read(pingTimerFd_, &expirations, sizeof(expirations)) > 0) {}
+			pingClients();
+		});
+	} else {
+		Logger::GetInstance()->Log("timerfd_create failed, clients are not pinged: " + std::string(strerror(errno)), L_WARNING);
+	}
 	selectEventOnRoot();
 	ConfigHandler::GetInstance().getConfigData<ConfigDataBindings>()->initKeycodes(display_,x11Wrapper.get());
 	if (wmDetected) {
 		throw std::runtime_error("Another window manager is already running.");
 	}
-	ConfigHandler::GetInstance().getConfigData<ConfigDataBindings>()->grabKeys(display_, root_);
+	auto bindings = ConfigHandler::GetInstance().getConfigData<ConfigDataBindings>();
+	bindings->grabKeys(display_, root_);
+	setFocusFollowsMouse(bindings->getFocusFollowsMouse());
+	// Mod1 + left button on any client, grabbed once on the root instead of on each client
+	const unsigned int numLock = bindings->getNumLockMask();
+	for (unsigned int lock : {0u, static_cast<unsigned int>(LockMask), numLock, LockMask | numLock})
+		x11Wrapper->grabButton(display_, Button1, Mod1Mask | lock, root_, false,
+							   ButtonPressMask | ButtonReleaseMask | ButtonMotionMask,
+							   GrabModeAsync, GrabModeAsync, None, None);
 	geometryX = x11Wrapper->displayWidth(display_, x11Wrapper->defaultScreen(display_));
 	geometryY = x11Wrapper->displayHeight(display_, x11Wrapper->defaultScreen(display_));
+	workArea_.setScreenSize(geometryX, geometryY);
+	screenChangeEvent_ = x11Wrapper->selectScreenChanges(display_, root_);
+	std::vector<size_t> released;
+	outputs_.update(readOutputs(), released);
 	x11Wrapper->grabServer(display_);
 	ewmh::initEwmh(display_,root_);
 	tsData = std::make_shared<TSBarsData>();
+	groupsChannel = tsData->getChannel("Groups");
+	activeGroupChannel = tsData->getChannel("ActiveGroup");
+	evCountChannel = tsData->getChannel("EvCount");
+	hungChannel = tsData->getChannel("Hung");
 	getTopLevelWindows();
 	createBars();
 	x11Wrapper->ungrabServer(display_);
 	ewmh::updateWmProperties(display_, root_);
 	x11Wrapper->flush(display_);
-	tsData->addData("EvCount", "0");
+	tsData->publishInt(evCountChannel, 0);
+	int configFd = ConfigHandler::GetInstance().watchConfigFile();
+	if (configFd >= 0) {
+		watchFd(configFd, [this]() {
+			if (ConfigHandler::GetInstance().configFileChanged())
+				reloadConfig();
+		});
+	}
+	ipcServer_ = std::unique_ptr<IpcServer>(new IpcServer(IpcServer::defaultPath(DisplayString(display_))));
+	if (!ipcServer_->start())
+		ipcServer_.reset();
+	LayoutManager::setCommitListener([this](const LayoutManager *layout) {
+		ignoreCrossings();
+		if (ipcServer_)
+			ipcServer_->layoutEvent(layout);
+	});
 	signal(SIGINT, handleSIGHUP);
 }
 void WindowManager::selectEventOnRoot() const {
@@ -121,6 +213,8 @@ void WindowManager::getTopLevelWindows() {
 	for (unsigned int i = 0; i < numTopLevelWindows; ++i) {
 		std::shared_ptr<Client> newClient = nullptr;
 		try {
+			if (manageDock(topLevelWindows[i]))
+				continue;
 			auto g = getActiveGroup();
 			newClient = std::make_shared<Client>(display_, root_, topLevelWindows[i], g,
 										 g->getInactiveColor(), g->getBorderSize(), x11Wrapper);
@@ -133,6 +227,7 @@ void WindowManager::getTopLevelWindows() {
 		}
 		if (newClient != nullptr) {
 			clients_[newClient->getWindow()] = newClient;
+			addToClientList(newClient->getWindow());
 		}
 	}
 	x11Wrapper->freeX(topLevelWindows);
@@ -141,29 +236,331 @@ void WindowManager::createBars() {
 	Bars::createInstance();
 	Bars::getInstance().init(ConfigHandler::GetInstance().getConfigData<ConfigDataBars>(), tsData, display_, root_);
 	Bars::getInstance().start_thread();
-	auto g = getActiveGroup();
-	unsigned int sizeX = geometryX- Bars::getInstance().getSpaceE() - Bars::getInstance().getSpaceW() - g->getBorderSize() * 2;
-	unsigned int sizeY = geometryY - Bars::getInstance().getSpaceN() - Bars::getInstance().getSpaceS() - g->getBorderSize() * 2;
-	unsigned int posX = Bars::getInstance().getSpaceW();
-	unsigned int posY = Bars::getInstance().getSpaceN();
-	for (auto &g:groups_) {
-		g->resize(sizeX,sizeY,posX,posY);
+	resizeGroups();
+}
+void WindowManager::resizeGroups() {
+	Strut bars;
+	bars.left = Bars::getInstance().getSpaceW();
+	bars.right = Bars::getInstance().getSpaceE();
+	bars.top = Bars::getInstance().getSpaceN();
+	bars.bottom = Bars::getInstance().getSpaceS();
+	workArea_.setBase(bars);
+	applyWorkArea();
+}
+void WindowManager::applyWorkArea() {
+	for (size_t i = 0; i < outputs_.size(); i++) {
+		bool assigned = false;
+		if (outputs_.getGroup(i) == Outputs::none) {
+			for (size_t g = 0; g < groups_.size() && !assigned; g++) {
+				if (outputs_.find(g) == Outputs::none) {
+					outputs_.setGroup(i, g);
+					assigned = true;
+				}
+			}
+			if (!assigned)
+				continue;
+		}
+		if (outputs_.setArea(i, workArea_) || assigned)
+			placeGroup(i);
+	}
+	ewmh::updateWorkArea(display_, root_, workArea_.getX(), workArea_.getY(),
+						 workArea_.getWidth(), workArea_.getHeight(), groups_.size());
+}
+void WindowManager::placeGroup(size_t output) {
+	auto group = groups_[outputs_.getGroup(output)];
+	const OutputGeometry &area = outputs_.getArea(output);
+	unsigned int sizeX = area.width - group->getBorderSize() * 2;
+	unsigned int sizeY = area.height - group->getBorderSize() * 2;
+	auto posX = static_cast<unsigned int>(area.x);
+	auto posY = static_cast<unsigned int>(area.y);
+	if (group->isActive()) {
+		group->resize(sizeX, sizeY, posX, posY);
+	} else {
+		group->resizeLater(sizeX, sizeY, posX, posY);
+		group->show();
+	}
+}
+std::vector<OutputGeometry> WindowManager::readOutputs() const {
+	std::vector<OutputGeometry> outputs;
+	x11Wrapper->getMonitors(display_, root_, outputs);
+	if (outputs.empty()) {
+		OutputGeometry screen;
+		screen.name = "default";
+		screen.width = geometryX;
+		screen.height = geometryY;
+		outputs.push_back(screen);
+	}
+	return outputs;
+}
+void WindowManager::updateOutputs(XEvent &event) {
+	x11Wrapper->updateScreenConfiguration(&event);
+	geometryX = x11Wrapper->displayWidth(display_, x11Wrapper->defaultScreen(display_));
+	geometryY = x11Wrapper->displayHeight(display_, x11Wrapper->defaultScreen(display_));
+	std::vector<size_t> released;
+	auto changed = outputs_.update(readOutputs(), released);
+	bool screen = workArea_.setScreenSize(geometryX, geometryY);
+	if (changed.empty() && released.empty() && !screen)
+		return;
+	Logger::GetInstance()->Log("Screen changed: " + std::to_string(outputs_.size()) + " outputs, "
+							   + std::to_string(changed.size()) + " new or moved", L_INFO);
+	LayoutBatch batch;
+	for (size_t group : released) {
+		if (group < groups_.size())
+			groups_[group]->switchFrom();
+	}
+	applyWorkArea();
+	size_t active = outputs_.getGroup(outputs_.getFocused());
+	if (active < groups_.size() && groups_[active] != active_group_.lock())
+		setActiveGroup(groups_[active]);
+	if (screen)
+		ewmh::updateDesktopGeometry(display_, root_);
+	ignoreCrossings();
+}
+void WindowManager::setFocusFollowsMouse(bool enabled) {
+	if (enabled && focusTimerFd_ < 0) {
+		focusTimerFd_ = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+		if (focusTimerFd_ < 0) {
+			Logger::GetInstance()->Log("timerfd_create failed, the focus does not follow the mouse: " + std::string(strerror(errno)), L_WARNING);
+			return;
+		}
+		watchFd(focusTimerFd_, [this]() {
+			uint64_t expirations;
+			while (read(focusTimerFd_, &expirations, sizeof(expirations)) > 0) {}
+			auto client = getClient(pendingFocus_);
+			pendingFocus_ = None;
+			if (focusFollowsMouse_ && client && client->getWindow() != activeWindow)
+				setFocus(client.get());
+		});
+	}
+	if (enabled == focusFollowsMouse_)
+		return;
+	focusFollowsMouse_ = enabled;
+	pendingFocus_ = None;
+	Client::setFollowMouse(enabled);
+	for (auto &client : clients_) {
+		if (client.second && client.second->isFramed())
+			client.second->selectFrameInput();
+	}
+	Logger::GetInstance()->Log(std::string("Focus follows mouse ") + (enabled ? "enabled" : "disabled"), L_INFO);
+}
+void WindowManager::pointerEntered(const XCrossingEvent &event) {
+	if (!focusFollowsMouse_ || focusTimerFd_ < 0)
+		return;
+	if (event.mode != NotifyNormal || event.detail == NotifyInferior || event.serial <= crossingSerial_)
+		return;
+	auto client = getClient(event.window);
+	if (!client || client->getFrame() != event.window)
+		return;
+	pendingFocus_ = client->getWindow();
+	// re-arming the timer restarts the dwell, only the last frame of a sweep gets the focus
+	itimerspec dwell{};
+	dwell.it_value.tv_nsec = focusDelay * 1000000L;
+	timerfd_settime(focusTimerFd_, 0, &dwell, nullptr);
+}
+void WindowManager::ignoreCrossings() {
+	crossingSerial_ = x11Wrapper->nextRequest(display_) - 1;
+}
+bool WindowManager::readStrut(Window window, Strut &strut) const {
+	for (Atom property : {NET_WM_STRUT_PARTIAL, NET_WM_STRUT}) {
+		Atom actualType = 0;
+		int actualFormat = 0;
+		unsigned long nItems = 0, bytesAfter = 0;
+		unsigned char *propData = nullptr;
+		x11Wrapper->getWindowProperty(display_, window, property, 0, 12, False, XA_CARDINAL,
+									  &actualType, &actualFormat, &nItems, &bytesAfter, &propData);
+		bool found = actualType == XA_CARDINAL && actualFormat == 32 && nItems >= 4 && propData != nullptr;
+		if (found) {
+			auto values = reinterpret_cast<const long *>(propData);
+			strut.left = static_cast<unsigned long>(values[0]);
+			strut.right = static_cast<unsigned long>(values[1]);
+			strut.top = static_cast<unsigned long>(values[2]);
+			strut.bottom = static_cast<unsigned long>(values[3]);
+		}
+		if (propData != nullptr)
+			x11Wrapper->freeX(propData);
+		if (found)
+			return true;
+	}
+	return false;
+}
+bool WindowManager::isDockType(Window window) const {
+	Atom actualType = 0;
+	int actualFormat = 0;
+	unsigned long nItems = 0, bytesAfter = 0;
+	unsigned char *propData = nullptr;
+	x11Wrapper->getWindowProperty(display_, window, NET_WM_WINDOW_TYPE, 0, 32, False, XA_ATOM,
+								  &actualType, &actualFormat, &nItems, &bytesAfter, &propData);
+	bool dock = false;
+	if (actualType == XA_ATOM && actualFormat == 32 && propData != nullptr) {
+		auto types = reinterpret_cast<const Atom *>(propData);
+		dock = std::find(types, types + nItems, NET_WM_WINDOW_TYPE_DOCK) != types + nItems;
+	}
+	if (propData != nullptr)
+		x11Wrapper->freeX(propData);
+	return dock;
+}
+bool WindowManager::manageDock(Window window) {
+	Strut strut;
+	bool hasStrut = readStrut(window, strut);
+	if (!hasStrut && !isDockType(window))
+		return false;
+	Logger::GetInstance()->Log("Dock window: " + std::to_string(window), L_INFO);
+	x11Wrapper->selectInput(display_, window, PropertyChangeMask);
+	x11Wrapper->mapWindow(display_, window);
+	if (workArea_.setStrut(window, strut))
+		applyWorkArea();
+	return true;
+}
+bool WindowManager::updateDock(Window window, Atom property) {
+	if (!workArea_.isDock(window))
+		return false;
+	if (property != NET_WM_STRUT && property != NET_WM_STRUT_PARTIAL)
+		return true;
+	Strut strut;
+	readStrut(window, strut);
+	if (workArea_.setStrut(window, strut))
+		applyWorkArea();
+	return true;
+}
+bool WindowManager::forgetDock(Window window) {
+	if (!workArea_.isDock(window))
+		return false;
+	if (workArea_.removeStrut(window))
+		applyWorkArea();
+	return true;
+}
+const WorkArea &WindowManager::getWorkArea() const { return workArea_; }
+const Outputs &WindowManager::getOutputs() const { return outputs_; }
+int WindowManager::getScreenChangeEvent() const { return screenChangeEvent_; }
+Atom WindowManager::getProtocolsAtom() const { return WM_PROTOCOLS; }
+void WindowManager::switchToGroup(size_t index) {
+	if (index >= groups_.size())
+		return;
+	size_t focused = outputs_.getFocused();
+	size_t shown = outputs_.find(index);
+	if (shown == focused && getActiveGroup() == groups_[index])
+		return;
+	if (shown != Outputs::none) {
+		// already on another output, focus that output instead of stealing the group
+		outputs_.setFocused(shown);
+		setActiveGroup(groups_[index]);
+		return;
+	}
+	getActiveGroup()->switchFrom();
+	if (focused >= outputs_.size()) {
+		groups_[index]->switchTo();
+		return;
+	}
+	outputs_.setGroup(focused, index);
+	outputs_.setArea(focused, workArea_);
+	placeGroup(focused);
+	setActiveGroup(groups_[index]);
+	ignoreCrossings();
+}
+void WindowManager::moveClientToGroup(Client *client, size_t index) {
+	if (client == nullptr || index >= groups_.size())
+		return;
+	auto from = client->getGroup();
+	auto to = groups_[index];
+	auto shared = getClient(client->getWindow());
+	if (from == to || !shared)
+		return;
+	if (client->isFullscreen())
+		setFullscreen(client, false);
+	if (from)
+		from->removeClient(client);
+	client->setGroup(to);
+	to->addClient(client->getWindow(), shared);
+	if (client->isFramed()) {
+		if (to->isActive())
+			x11Wrapper->mapWindow(display_, client->getFrame());
+		else
+			x11Wrapper->unmapWindow(display_, client->getFrame());
+	}
+	ewmh::updateWmDesktop(display_, client->getWindow(), index);
+}
+void WindowManager::setFullscreen(Client *client, bool fullscreen) {
+	if (client == nullptr || client->isFullscreen() == fullscreen)
+		return;
+	auto group = client->getGroup();
+	client->setFullscreen(fullscreen);
+	XWindowChanges changes;
+	changes.border_width = fullscreen || !group ? 0 : group->getBorderSize();
+	if (client->isFramed())
+		x11Wrapper->configureWindow(display_, client->getFrame(), CWBorderWidth, &changes);
+	if (fullscreen) {
+		size_t output = outputs_.find(getGroupIndex(group));
+		OutputGeometry screen;
+		screen.width = geometryX;
+		screen.height = geometryY;
+		if (output != Outputs::none)
+			screen = outputs_.getGeometry(output);
+		if (client->isFramed()) {
+			x11Wrapper->moveWindow(display_, client->getFrame(), screen.x, screen.y);
+			x11Wrapper->resizeWindow(display_, client->getFrame(), screen.width, screen.height);
+		}
+		x11Wrapper->resizeWindow(display_, client->getWindow(), screen.width, screen.height);
+		client->restack();
+	} else if (group) {
+		group->getLayoutManager()->forgetClient(client);
+		group->getLayoutManager()->relayout();
 	}
+	ewmh::updateWmState(display_, client->getWindow(), fullscreen);
+}
+size_t WindowManager::getGroupIndex(const std::shared_ptr<Group> &group) const {
+	return std::find(groups_.begin(), groups_.end(), group) - groups_.begin();
+}
+void WindowManager::pingClients() {
+	bool changed = false;
+	pingTimestamp_++;
+	for (Window window : clientList_) {
+		auto it = clients_.find(window);
+		if (it == clients_.end() || !it->second || !it->second->pingTick(pingTimestamp_))
+			continue;
+		changed = true;
+		if (ipcServer_)
+			ipcServer_->clientEvent(IPC_WINDOW, it->second.get(), "hung");
+	}
+	x11Wrapper->flush(display_);
+	if (changed)
+		publishHung();
+}
+bool WindowManager::handlePong(const XClientMessageEvent &event) {
+	if (event.message_type != WM_PROTOCOLS || static_cast<Atom>(event.data.l[0]) != NET_WM_PING)
+		return false;
+	auto client = getClient(static_cast<Window>(event.data.l[2]));
+	if (client && client->pong(static_cast<Time>(event.data.l[1]))) {
+		Logger::GetInstance()->Log("Client responding again: " + client->getTitle(), L_INFO);
+		if (ipcServer_)
+			ipcServer_->clientEvent(IPC_WINDOW, client.get(), "responsive");
+		publishHung();
+	}
+	return true;
+}
+void WindowManager::publishHung() {
+	std::vector<std::string> groups;
+	for (Window window : clientList_) {
+		auto it = clients_.find(window);
+		if (it == clients_.end() || !it->second || !it->second->isHung() || !it->second->getGroup())
+			continue;
+		std::string name = it->second->getGroup()->getName();
+		if (std::find(groups.begin(), groups.end(), name) == groups.end())
+			groups.push_back(name);
+	}
+	tsData->publishStringList(hungChannel, groups);
 }
 void WindowManager::addGroupsFromConfig() {
 	auto configGroups = ConfigHandler::GetInstance().getConfigData<ConfigDataGroups>()->getGroups();
-	std::string groupsNames = "";
+	std::vector<std::string> groupsNames;
 	for (auto group: configGroups) {
 		std::shared_ptr<Group> g = std::make_shared<Group>(group, x11Wrapper,display_,root_);
-		groupsNames += g->getName() + ",";
+		groupsNames.push_back(g->getName());
 		groups_.push_back(g);
 	}
-	if (groupsNames.back() == ',') {
-		groupsNames.pop_back();
-	}
-	tsData->addData("Groups", groupsNames);
+	tsData->publishStringList(groupsChannel, groupsNames);
 	groups_[0]->setActive(true);
-	tsData->addData("ActiveGroup", groups_[0]->getName());
+	tsData->publishInt(activeGroupChannel, 0);
+	ewmh::updateCurrentDesktop(display_, root_, 0);
 	active_group_ = groups_[0];
 	Logger::GetInstance()->Log("Active Group is [" + getActiveGroup()->getName() + "]", L_INFO);
 }
@@ -171,11 +568,38 @@ void WindowManager::Run() {
 	Logger::GetInstance()->Log("================ Yggdrasil WM Running ================\n\n", L_INFO);
 	EventHandler::create();
 	XEvent e;
-//	int evcount = 0;
-	while (running && !x11Wrapper->nextEvent(display_, &e)) {
-		EventHandler::getInstance()->dispatchEvent(e);
+	std::vector<pollfd> fds;
+	while (running) {
+		while (running && x11Wrapper->pending(display_) > 0) {
+			x11Wrapper->nextEvent(display_, &e);
+			EventHandler::getInstance()->dispatchEvent(e);
+		}
+		if (!running)
+			break;
+		flushClientLists();
 		x11Wrapper->sync(display_, false);
-//		tsData->modifyData("EvCount", std::to_string(evcount++));
+		if (x11Wrapper->pending(display_) > 0)
+			continue;
+		fds.clear();
+		fds.push_back({x11Wrapper->connectionNumber(display_), POLLIN, 0});
+		for (auto &watched : watchedFds_)
+			fds.push_back({watched.fd, watched.events, 0});
+		if (poll(fds.data(), fds.size(), -1) < 0) {
+			if (errno == EINTR)
+				continue;
+			Logger::GetInstance()->Log("poll failed: " + std::string(strerror(errno)), L_ERROR);
+			break;
+		}
+		for (size_t i = 1; i < fds.size(); i++) {
+			if (fds[i].revents == 0)
+				continue;
+			auto it = std::find_if(watchedFds_.begin(), watchedFds_.end(),
+								   [&](const WatchedFd &w) { return w.fd == fds[i].fd; });
+			if (it != watchedFds_.end()) {
+				auto callback = it->callback;
+				callback();
+			}
+		}
 	}
 	Logger::GetInstance()->Log("WindowManager stopped", L_INFO);
 //	XCloseDisplay(display_);
@@ -192,6 +616,20 @@ void WindowManager::testRun() {
 	EventHandler::getInstance()->dispatchEvent(ev);
 	x11Wrapper->sync(display_, false);
 }
+void WindowManager::watchFd(int fd, std::function<void()> callback, short events) {
+	watchedFds_.push_back({fd, events, std::move(callback)});
+}
+void WindowManager::setWatchedEvents(int fd, short events) {
+	for (auto &watched : watchedFds_) {
+		if (watched.fd == fd)
+			watched.events = events;
+	}
+}
+void WindowManager::unwatchFd(int fd) {
+	watchedFds_.erase(std::remove_if(watchedFds_.begin(), watchedFds_.end(),
+									 [fd](const WatchedFd &w) { return w.fd == fd; }),
+					  watchedFds_.end());
+}
 void WindowManager::insertClient(Window window) {
 	try {
 		int borderSize = getActiveGroup()->getBorderSize();
@@ -205,8 +643,66 @@ void WindowManager::insertClient(Window window) {
 		Logger::GetInstance()->Log(e.what(), L_ERROR);
 	}
 }
+void WindowManager::addToClientList(Window window) {
+	if (std::find(clientList_.begin(), clientList_.end(), window) != clientList_.end())
+		return;
+	clientList_.push_back(window);
+	stackingList_.push_back(window);
+	ewmh::appendClientList(display_, root_, window);
+	auto client = getClient(window);
+	if (client)
+		ewmh::updateWmDesktop(display_, window, getGroupIndex(client->getGroup()));
+}
+void WindowManager::removeFromClientList(Window window) {
+	auto it = std::find(clientList_.begin(), clientList_.end(), window);
+	if (it == clientList_.end())
+		return;
+	clientList_.erase(it);
+	stackingList_.erase(std::remove(stackingList_.begin(), stackingList_.end(), window), stackingList_.end());
+	clientListDirty_ = true;
+	auto client = clients_.find(window);
+	if (client != clients_.end() && client->second && client->second->isHung())
+		publishHung();
+}
+void WindowManager::flushClientLists() {
+	bool restacked = Client::takeRestacked();
+	if (restacked)
+		ignoreCrossings();
+	if (!clientListDirty_ && !restacked)
+		return;
+	if (clientListDirty_)
+		ewmh::updateClientList(display_, root_, clientList_);
+	std::vector<std::pair<unsigned long, Window>> order;
+	order.reserve(stackingList_.size());
+	for (Window window : stackingList_) {
+		auto it = clients_.find(window);
+		order.emplace_back(it != clients_.end() && it->second ? it->second->getStackOrder() : 0, window);
+	}
+	std::stable_sort(order.begin(), order.end(),
+					 [](const std::pair<unsigned long, Window> &a, const std::pair<unsigned long, Window> &b) {
+						 return a.first < b.first;
+					 });
+	bool moved = false;
+	for (size_t i = 0; i < order.size(); i++) {
+		if (stackingList_[i] != order[i].second) {
+			stackingList_[i] = order[i].second;
+			moved = true;
+		}
+	}
+	if (clientListDirty_ || moved)
+		ewmh::updateClientListStacking(display_, root_, stackingList_);
+	clientListDirty_ = false;
+}
 void WindowManager::setFocus(Client *client) {
 	if (client != nullptr) {
+		auto group = client->getGroup();
+		size_t output = group ? outputs_.find(getGroupIndex(group)) : Outputs::none;
+		if (output != Outputs::none && output != outputs_.getFocused()) {
+			outputs_.setFocused(output);
+			setActiveGroup(group);
+		}
+		if (group && group->getLayoutManager())
+			group->getLayoutManager()->focusClient(client);
 		x11Wrapper->setInputFocus(display_, client->getWindow(), RevertToParent, CurrentTime);
 	}
 }
@@ -266,7 +762,13 @@ std::shared_ptr<Client> WindowManager::getClientRef(Window window) { return clie
 Window WindowManager::getRoot() const { return root_; }
 unsigned long WindowManager::getClientCount() { return clients_.size(); }
 void WindowManager::setActiveGroup(std::shared_ptr<Group> activeGroup) {
-	tsData->modifyData("ActiveGroup", activeGroup->getName());
+	auto it = std::find(groups_.begin(), groups_.end(), activeGroup);
+	if (it != groups_.end()) {
+		tsData->publishInt(activeGroupChannel, it - groups_.begin());
+		ewmh::updateCurrentDesktop(display_, root_, it - groups_.begin());
+		if (ipcServer_)
+			ipcServer_->groupEvent(activeGroup, it - groups_.begin());
+	}
 	active_group_ = std::weak_ptr<Group> (activeGroup);
 }
 std::shared_ptr <Group>WindowManager::getActiveGroup() const {
@@ -282,6 +784,7 @@ unsigned int WindowManager::getGeometryX() const { return geometryX; }
 unsigned int WindowManager::getGeometryY() const { return geometryY; }
 Window WindowManager::getActiveWindow() const { return activeWindow; }
 const std::shared_ptr<BaseX11Wrapper> &WindowManager::getX11Wrapper() const { return x11Wrapper; }
+IpcServer *WindowManager::getIpcServer() const { return ipcServer_.get(); }
 void WindowManager::setActiveWindow(Window aWindow) { WindowManager::activeWindow = aWindow; }
 int WindowManager::OnXError(Display *display, XErrorEvent *e) {
 	const int MAX_ERROR_TEXT_LENGTH = 1024;
@@ -307,6 +810,41 @@ void WindowManager::setActiveGroup(Group *activeGroup) {
 	WindowManager::active_group_ = std::shared_ptr<Group>(activeGroup);
 }
 
-
-
-
+void WindowManager::reloadConfig() {
+	ConfigHandler &config = ConfigHandler::GetInstance();
+	ConfigReload reload = config.reload();
+	const Json::Value &root = config.getRoot();
+	if (reload.bindings) {
+		auto bindings = config.getConfigData<ConfigDataBindings>();
+		try {
+			bindings->initKeycodes(display_, x11Wrapper.get());
+			bindings->replaceGrabs(*reload.bindings, display_, x11Wrapper.get(), {root_});
+			setFocusFollowsMouse(bindings->getFocusFollowsMouse());
+		} catch (const std::exception &e) {
+			Logger::GetInstance()->Log(std::string("Reloaded bindings: ") + e.what(), L_ERROR);
+		}
+	}
+	if (reload.groups) {
+		const auto &groupsConfig = config.getConfigData<ConfigDataGroups>()->getGroups();
+		if (groupsConfig.size() != groups_.size())
+			Logger::GetInstance()->Log("Groups added or removed, applied on restart", L_WARNING);
+		for (size_t i = 0; i < groups_.size() && i < groupsConfig.size(); i++) {
+			Json::ArrayIndex index = static_cast<Json::ArrayIndex>(i);
+			if (reload.previous["Groups"][index] != root["Groups"][index])
+				groups_[i]->applyConfig(groupsConfig[i]);
+		}
+	}
+	if (reload.bars) {
+		auto barsConfig = config.getConfigData<ConfigDataBars>();
+		const Json::Value &previous = reload.previous["Bars"];
+		const Json::Value &current = root["Bars"];
+		std::vector<size_t> changed;
+		for (Json::ArrayIndex i = 0; i < std::max(previous.size(), current.size()); i++) {
+			if (i >= previous.size() || i >= current.size() || previous[i] != current[i])
+				changed.push_back(i);
+		}
+		if (Bars::getInstance().reconfigure(barsConfig, changed))
+			resizeGroups();
+	}
+	x11Wrapper->flush(display_);
+}
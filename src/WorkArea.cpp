@@ -0,0 +1,86 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file WorkArea.cpp
+ * @brief WorkArea class implementation.
+ * @date 2026-10-19
+ */
+#include "WorkArea.hpp"
+#include <algorithm>
+
+WorkArea::WorkArea(unsigned int width, unsigned int height)
+		: width_(width), height_(height), base_(), reserved_(), struts_() {}
+
+bool WorkArea::setScreenSize(unsigned int width, unsigned int height) {
+	if (width == width_ && height == height_)
+		return false;
+	width_ = width;
+	height_ = height;
+	recompute();
+	return true;
+}
+
+bool WorkArea::setBase(const Strut &strut) {
+	if (strut == base_)
+		return false;
+	base_ = strut;
+	return recompute();
+}
+
+bool WorkArea::setStrut(Window window, const Strut &strut) {
+	auto it = struts_.find(window);
+	if (it != struts_.end() && it->second == strut)
+		return false;
+	struts_[window] = strut;
+	return recompute();
+}
+
+bool WorkArea::removeStrut(Window window) {
+	if (struts_.erase(window) == 0)
+		return false;
+	return recompute();
+}
+
+bool WorkArea::recompute() {
+	Strut reserved = base_;
+	for (const auto &entry : struts_) {
+		reserved.left = std::max(reserved.left, entry.second.left);
+		reserved.right = std::max(reserved.right, entry.second.right);
+		reserved.top = std::max(reserved.top, entry.second.top);
+		reserved.bottom = std::max(reserved.bottom, entry.second.bottom);
+	}
+	reserved.left = std::min<unsigned long>(reserved.left, width_ / 2);
+	reserved.right = std::min<unsigned long>(reserved.right, width_ / 2);
+	reserved.top = std::min<unsigned long>(reserved.top, height_ / 2);
+	reserved.bottom = std::min<unsigned long>(reserved.bottom, height_ / 2);
+	if (reserved == reserved_)
+		return false;
+	reserved_ = reserved;
+	return true;
+}
+
+bool WorkArea::isDock(Window window) const { return struts_.count(window) != 0; }
+const Strut &WorkArea::getReserved() const { return reserved_; }
+int WorkArea::getX() const { return static_cast<int>(reserved_.left); }
+int WorkArea::getY() const { return static_cast<int>(reserved_.top); }
+unsigned int WorkArea::getWidth() const { return width_ - reserved_.left - reserved_.right; }
+unsigned int WorkArea::getHeight() const { return height_ - reserved_.top - reserved_.bottom; }
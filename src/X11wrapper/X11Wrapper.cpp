@@ -27,6 +27,11 @@
 
 #include "X11wrapper/X11Wrapper.hpp"
 #include "YggdrasilExceptions.hpp"
+#ifdef YGGDRASIL_XRANDR
+extern "C" {
+#include <X11/extensions/Xrandr.h>
+}
+#endif
 
 Display *X11Wrapper::openDisplay() {
 	Display * r = XOpenDisplay(nullptr);
@@ -134,6 +139,82 @@ int X11Wrapper::nextEvent(Display *display, XEvent *eventReturn) {
 	return r;
 }
 
+int X11Wrapper::pending(Display *display) {
+	return XPending(display);
+}
+
+int X11Wrapper::connectionNumber(Display *display) {
+	return ConnectionNumber(display);
+}
+
+int X11Wrapper::refreshKeyboardMapping(XMappingEvent *event) {
+	return XRefreshKeyboardMapping(event);
+}
+
+int X11Wrapper::killClient(Display *display, XID resource) {
+	return XKillClient(display, resource);
+}
+
+unsigned long X11Wrapper::nextRequest(Display *display) {
+	return NextRequest(display);
+}
+
+int X11Wrapper::selectScreenChanges(Display *display, Window window) {
+#ifdef YGGDRASIL_XRANDR
+	int eventBase = 0;
+	int errorBase = 0;
+	if (!XRRQueryExtension(display, &eventBase, &errorBase))
+		return -1;
+	XRRSelectInput(display, window, RRScreenChangeNotifyMask);
+	return eventBase + RRScreenChangeNotify;
+#else
+	(void)display;
+	(void)window;
+	return -1;
+#endif
+}
+
+int X11Wrapper::updateScreenConfiguration(XEvent *event) {
+#ifdef YGGDRASIL_XRANDR
+	return XRRUpdateConfiguration(event);
+#else
+	(void)event;
+	return 0;
+#endif
+}
+
+int X11Wrapper::getMonitors(Display *display, Window window, std::vector<OutputGeometry> &outputs) {
+	outputs.clear();
+#ifdef YGGDRASIL_XRANDR
+	int count = 0;
+	XRRMonitorInfo *monitors = XRRGetMonitors(display, window, True, &count);
+	if (monitors == nullptr)
+		return 0;
+	for (int i = 0; i < count; i++) {
+		OutputGeometry output;
+		char *name = monitors[i].name != None ? XGetAtomName(display, monitors[i].name) : nullptr;
+		output.name = name != nullptr ? name : std::to_string(i);
+		if (name != nullptr)
+			XFree(name);
+		output.x = monitors[i].x;
+		output.y = monitors[i].y;
+		output.width = static_cast<unsigned int>(monitors[i].width);
+		output.height = static_cast<unsigned int>(monitors[i].height);
+		// the primary monitor comes first, it gets the first group
+		if (monitors[i].primary)
+			outputs.insert(outputs.begin(), output);
+		else
+			outputs.push_back(output);
+	}
+	XRRFreeMonitors(monitors);
+	return count;
+#else
+	(void)display;
+	(void)window;
+	return 0;
+#endif
+}
+
 int X11Wrapper::sendEvent(Display *display, Window window, bool propagate, long eventMask, XEvent *event_send) {
 	int r = XSendEvent(display, window, propagate, eventMask, event_send);
 	if (r == 0) {
@@ -344,28 +425,20 @@ int X11Wrapper::grabKey(Display *display,
 						bool ownerEvents,
 						int pointerMode,
 						int keyboardMode) {
-	int r = XGrabKey(display,
-					 keycode,
-					 modifiers,
-					 grabWindow,
-					 ownerEvents,
-					 pointerMode,
-					 keyboardMode);
-	if (r != 0) {
-		throw X11Exception("Failed to grab key");
-	}
-	return r;
+	return XGrabKey(display,
+					keycode,
+					modifiers,
+					grabWindow,
+					ownerEvents,
+					pointerMode,
+					keyboardMode);
 }
 
 int X11Wrapper::ungrabKey(Display *display,
 						  int keycode,
 						  unsigned int modifiers,
 						  Window grabWindow) {
-	int r = XUngrabKey(display, keycode, modifiers, grabWindow);
-	if (r != 0) {
-		throw X11Exception("Failed to ungrab key");
-	}
-	return r;
+	return XUngrabKey(display, keycode, modifiers, grabWindow);
 }
 
 int X11Wrapper::moveWindow(Display *display, Window window, int x, int y) {
@@ -29,6 +29,10 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include "Config/Binding.hpp"
+#include "Commands/Grow.hpp"
+#include "Group.hpp"
+#include "Client.hpp"
+#include "Layouts/MasterLayoutManager.hpp"
 #include "Logger.hpp"
 #include <sstream>
 #include "X11wrapper/mockX11Wrapper.hpp"
@@ -37,6 +41,7 @@ extern "C" {
 }
 using ::testing::Return;
 using ::testing::_;
+using ::testing::NiceMock;
 
 class BindingTest : public ::testing::Test
 {
@@ -113,7 +118,49 @@ TEST_F(BindingTest, wrongInit) {
 	EXPECT_THROW(binding3.execute(nullptr), std::runtime_error);
 }
 
+TEST_F(BindingTest, initReloadWidgets) {
+	Binding binding;
+	EXPECT_NO_THROW(binding.init("Mod1", "R", "ReloadWidgets", ""));
+	EXPECT_EQ(binding.getCommandName(), "ReloadWidgets");
+}
+TEST_F(BindingTest, initFocusNext) {
+	Binding binding;
+	EXPECT_NO_THROW(binding.init("Mod1", "Tab", "FocusNext", "1"));
+	EXPECT_EQ(binding.getCommandName(), "FocusNext");
+}
 TEST_F(BindingTest, execBeforeInit) {
 	Binding binding;
 	EXPECT_THROW(binding.execute(nullptr), std::runtime_error);
-}
\ No newline at end of file
+}
+TEST_F(BindingTest, growArgumentsArePreparedOnce) {
+	Grow grow;
+	grow.prepare("-4");
+	EXPECT_EQ(grow.getInc(), -4);
+	grow.prepare("not a number");
+	EXPECT_EQ(grow.getInc(), 0);
+}
+TEST_F(BindingTest, growUsesTheGroupOfTheTarget) {
+	auto wrapper = std::make_shared<NiceMock<mockX11Wrapper>>();
+	ON_CALL(*wrapper, displayWidth(_, _)).WillByDefault(Return(800));
+	ON_CALL(*wrapper, displayHeight(_, _)).WillByDefault(Return(600));
+	Json::Value root;
+	root["Name"] = "2";
+	root["Layout"] = "MasterVertical";
+	root["Inactive_Color"] = "#FF0000";
+	root["Active_Color"] = "#00FF00";
+	root["Border_Size"] = 1;
+	root["Gap"] = 0;
+	auto config = std::make_shared<ConfigDataGroup>();
+	config->configInit(root);
+	auto group = std::make_shared<Group>(config, wrapper, nullptr, 42);
+	Client client(nullptr, 42, 1000, group, 0, 1, wrapper);
+	auto lm = std::dynamic_pointer_cast<MasterLayoutManager>(group->getLayoutManager());
+	ASSERT_NE(lm, nullptr);
+	double before = lm->getRatio();
+	Grow grow;
+	grow.prepare("80");
+	CommandContext context;
+	context.target = &client;
+	grow.execute(context);
+	EXPECT_GT(lm->getRatio(), before);
+}
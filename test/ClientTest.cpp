@@ -99,6 +99,7 @@ protected:
 		ON_CALL(*x11WrapperMock,raiseWindow(_,_))
 				.WillByDefault(Return(Success));
 		group =  std::make_shared<Group>(config,x11WrapperMock,display,rootWindow);
+		Client::setProtocolAtoms(mockAtom, mockAtom, mockAtom);
 		EXPECT_CALL(*x11WrapperMock,internAtom(display,_,_))
 				.Times(AtLeast(1))
 				.WillRepeatedly(Return(mockAtom)); // Adjust as necessary
@@ -141,6 +142,9 @@ TEST_F(ClientTest, Frame) {
 	EXPECT_CALL(*x11WrapperMock, selectInput(_,_,SubstructureNotifyMask | SubstructureRedirectMask | FocusChangeMask | ClientMessage))
 				.Times(1)
 				.WillOnce(Return(Success));
+	EXPECT_CALL(*x11WrapperMock, selectInput(_,_,PropertyChangeMask))
+				.Times(1)
+				.WillOnce(Return(Success));
 	EXPECT_CALL(*x11WrapperMock, addToSaveSet(_, _))
 				.Times(1)
 				.WillOnce(Return(Success));
@@ -151,8 +155,7 @@ TEST_F(ClientTest, Frame) {
 				.Times(1)
 				.WillOnce(Return(Success));
 	EXPECT_CALL(*x11WrapperMock, grabButton(_,_,_,_,_,_,_,_,_,_))
-				.Times(1)
-				.WillOnce(Return(Success));
+				.Times(0);
 	client->frame();
 	EXPECT_EQ(client->getFrame(), clientWindow);
 	EXPECT_TRUE(client->isFramed());
@@ -161,6 +164,22 @@ TEST_F(ClientTest, Frame) {
 				.Times(1)
 				.WillOnce(Return(Success));
 }
+TEST_F(ClientTest, frameSelectsEnterWhenFocusFollowsMouse) {
+	ON_CALL(*x11WrapperMock, getWindowAttributes(_, _, _))
+			.WillByDefault(Invoke([](Display* display, Window w, XWindowAttributes* attrs) -> int {
+				SetMockWindowAttributes(attrs,0);
+				return 1;
+			}));
+	ON_CALL(*x11WrapperMock, createSimpleWindow(_, _, _, _, _, _, _, _, _)).WillByDefault(Return(clientWindow));
+	const long frameMask = SubstructureNotifyMask | SubstructureRedirectMask | FocusChangeMask | ClientMessage;
+	EXPECT_CALL(*x11WrapperMock, selectInput(_, _, PropertyChangeMask)).Times(::testing::AnyNumber());
+	EXPECT_CALL(*x11WrapperMock, selectInput(_, clientWindow, frameMask | EnterWindowMask)).Times(1);
+	Client::setFollowMouse(true);
+	client->frame();
+	Client::setFollowMouse(false);
+	EXPECT_CALL(*x11WrapperMock, selectInput(_, clientWindow, frameMask)).Times(1);
+	client->selectFrameInput();
+}
 TEST_F(ClientTest, FrameOverideRedirect) {
 	EXPECT_CALL(*x11WrapperMock, getWindowAttributes(_, _, _))
 			.WillOnce(Invoke([](Display *display, Window w, XWindowAttributes *attrs) -> int {
@@ -187,6 +206,9 @@ TEST_F(ClientTest, restack) {
 	EXPECT_CALL(*x11WrapperMock, selectInput(_,_,SubstructureNotifyMask | SubstructureRedirectMask | FocusChangeMask | ClientMessage))
 			.Times(1)
 			.WillOnce(Return(Success));
+	EXPECT_CALL(*x11WrapperMock, selectInput(_,_,PropertyChangeMask))
+			.Times(1)
+			.WillOnce(Return(Success));
 	EXPECT_CALL(*x11WrapperMock, addToSaveSet(_, _))
 			.Times(1)
 			.WillOnce(Return(Success));
@@ -197,8 +219,7 @@ TEST_F(ClientTest, restack) {
 			.Times(1)
 			.WillOnce(Return(Success));
 	EXPECT_CALL(*x11WrapperMock, grabButton(_,_,_,_,_,_,_,_,_,_))
-			.Times(1)
-			.WillOnce(Return(Success));
+			.Times(0);
 	client->frame();
 	EXPECT_CALL(*x11WrapperMock, raiseWindow(_, clientWindow))
 			.Times(2)
@@ -217,6 +238,9 @@ TEST_F(ClientTest, unframe) {
 	EXPECT_CALL(*x11WrapperMock, selectInput(_,_,SubstructureNotifyMask | SubstructureRedirectMask | FocusChangeMask | ClientMessage))
 			.Times(1)
 			.WillOnce(Return(Success));
+	EXPECT_CALL(*x11WrapperMock, selectInput(_,_,PropertyChangeMask))
+			.Times(1)
+			.WillOnce(Return(Success));
 	EXPECT_CALL(*x11WrapperMock, addToSaveSet(_, _))
 			.Times(1)
 			.WillOnce(Return(Success));
@@ -227,8 +251,7 @@ TEST_F(ClientTest, unframe) {
 			.Times(1)
 			.WillOnce(Return(Success));
 	EXPECT_CALL(*x11WrapperMock, grabButton(_,_,_,_,_,_,_,_,_,_))
-			.Times(1)
-			.WillOnce(Return(Success));
+			.Times(0);
 	client->frame();
 	EXPECT_CALL(*x11WrapperMock, destroyWindow(_, clientWindow))
 			.Times(1)
@@ -237,4 +260,63 @@ TEST_F(ClientTest, unframe) {
 	EXPECT_EQ(client->getFrame(), 0);
 	EXPECT_FALSE(client->isFramed());
 	EXPECT_THROW(client->unframe(), YggdrasilException);
-}
\ No newline at end of file
+}
+
+TEST_F(ClientTest, restackOrdersClients) {
+	Client other(display, rootWindow, clientWindow + 1, group, inActiveColor, borderSize, x11WrapperMock);
+	Client::takeRestacked();
+	EXPECT_FALSE(Client::takeRestacked());
+	client->restack();
+	other.restack();
+	EXPECT_TRUE(Client::takeRestacked());
+	EXPECT_FALSE(Client::takeRestacked());
+	EXPECT_LT(client->getStackOrder(), other.getStackOrder());
+	client->restack();
+	EXPECT_GT(client->getStackOrder(), other.getStackOrder());
+}
+static int SetProtocols(Display *, Window, Atom, long, long, bool, Atom, Atom *type, int *format,
+						unsigned long *nItems, unsigned long *bytesAfter, unsigned char **data) {
+	static Atom protocols[] = {42};
+	*type = XA_ATOM;
+	*format = 32;
+	*nItems = 1;
+	*bytesAfter = 0;
+	*data = reinterpret_cast<unsigned char *>(protocols);
+	return Success;
+}
+TEST_F(ClientTest, closeKillsClientsWithoutDeleteWindow) {
+	EXPECT_FALSE(client->supportsPing());
+	EXPECT_CALL(*x11WrapperMock, sendEvent(_, _, _, _, _)).Times(0);
+	EXPECT_CALL(*x11WrapperMock, killClient(_, clientWindow)).Times(1);
+	client->close();
+	EXPECT_FALSE(client->pingTick(1));
+}
+TEST_F(ClientTest, closeAndPingUseTheProtocols) {
+	EXPECT_CALL(*x11WrapperMock, getWindowProperty(_, clientWindow, _, _, _, _, XA_ATOM, _, _, _, _, _))
+			.WillOnce(Invoke(SetProtocols));
+	client->updateProtocols();
+	EXPECT_TRUE(client->supportsPing());
+	EXPECT_CALL(*x11WrapperMock, killClient(_, _)).Times(0);
+	EXPECT_CALL(*x11WrapperMock, sendEvent(_, clientWindow, false, NoEventMask, _)).Times(2);
+	client->close();
+	EXPECT_FALSE(client->pingTick(1));
+	EXPECT_TRUE(client->pingTick(2));
+	EXPECT_TRUE(client->isHung());
+	EXPECT_FALSE(client->pingTick(3));
+	EXPECT_FALSE(client->pong(2));
+	EXPECT_TRUE(client->isHung());
+	EXPECT_TRUE(client->pong(1));
+	EXPECT_FALSE(client->isHung());
+	EXPECT_FALSE(client->pong(1));
+}
+TEST_F(ClientTest, latePongDoesNotAnswerANewerPing) {
+	EXPECT_CALL(*x11WrapperMock, getWindowProperty(_, clientWindow, _, _, _, _, XA_ATOM, _, _, _, _, _))
+			.WillOnce(Invoke(SetProtocols));
+	client->updateProtocols();
+	EXPECT_FALSE(client->pingTick(1));
+	EXPECT_FALSE(client->pong(1));
+	EXPECT_FALSE(client->pingTick(2));
+	EXPECT_FALSE(client->pong(1));
+	EXPECT_TRUE(client->pingTick(3));
+	EXPECT_TRUE(client->pong(2));
+}
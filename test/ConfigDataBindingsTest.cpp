@@ -33,6 +33,9 @@
 #include <sstream>
 #include "json/json.h"
 #include "X11wrapper/mockX11Wrapper.hpp"
+extern "C" {
+#include <X11/keysym.h>
+}
 using ::testing::TestWithParam;
 using ::testing::Values;
 
@@ -63,9 +66,102 @@ protected:
 
 std::ostringstream ConfigDataBindingsTest::oss = std::ostringstream ();
 std::string configPath = "ConfigDataBindingTest.json";
+Json::Value makeBindingJson(std::string configJson);
 TEST_F(ConfigDataBindingsTest, CreateConfigDataBindings) {
 	ASSERT_NE(cdb, nullptr);
 }
+TEST_F(ConfigDataBindingsTest, dispatchTableIgnoresLocks) {
+	::testing::NiceMock<mockX11Wrapper> wrapper;
+	ON_CALL(wrapper, stringToKeysym(::testing::_)).WillByDefault([](const char *key) { return static_cast<KeySym>(key[0]); });
+	ON_CALL(wrapper, keysymToKeycode(::testing::_, ::testing::_)).WillByDefault([](Display *, int keysym) { return keysym; });
+	cdb->configInit(makeBindingJson("{\"Mod1\":[{\"Key\":\"1\",\"Action\":\"FocusGroup\",\"Argument\":\"1\"}],"
+									"\"Mod4\":[{\"Key\":\"1\",\"Action\":\"FocusGroup\",\"Argument\":\"2\"}]}"));
+	cdb->initKeycodes(nullptr, &wrapper);
+	Binding *b = cdb->findBinding('1', Mod1Mask | LockMask | Mod2Mask);
+	ASSERT_NE(b, nullptr);
+	EXPECT_EQ(b->getArgs(), "1");
+	b = cdb->findBinding('1', Mod4Mask | Button1Mask);
+	ASSERT_NE(b, nullptr);
+	EXPECT_EQ(b->getArgs(), "2");
+	EXPECT_EQ(cdb->findBinding('1', Mod1Mask | ShiftMask), nullptr);
+	EXPECT_EQ(cdb->findBinding('2', Mod1Mask), nullptr);
+}
+TEST_F(ConfigDataBindingsTest, focusFollowsMouseIsNotABinding) {
+	EXPECT_FALSE(cdb->getFocusFollowsMouse());
+	cdb->configInit(makeBindingJson("{\"FocusFollowsMouse\":true,"
+									"\"Mod1\":[{\"Key\":\"1\",\"Action\":\"FocusGroup\",\"Argument\":\"1\"}]}"));
+	EXPECT_TRUE(cdb->getFocusFollowsMouse());
+	EXPECT_EQ(cdb->getBindings().size(), 1u);
+}
+TEST_F(ConfigDataBindingsTest, chordAndModeWalkTheTrie) {
+	::testing::NiceMock<mockX11Wrapper> wrapper;
+	ON_CALL(wrapper, stringToKeysym(::testing::_)).WillByDefault([](const char *key) { return static_cast<KeySym>(key[0]); });
+	ON_CALL(wrapper, keysymToKeycode(::testing::_, ::testing::_)).WillByDefault([](Display *, int keysym) { return keysym; });
+	cdb->configInit(makeBindingJson("{\"Mod1\":[{\"Key\":\"m\",\"Action\":\"Mode\",\"Argument\":\"resize\"}],"
+									"\"Modes\":{\"resize\":[{\"Key\":\"h\",\"Action\":\"ReloadWidgets\",\"Argument\":\"\"},"
+									"{\"Key\":\"Shift+l\",\"Action\":\"ReloadWidgets\",\"Argument\":\"\"}]},"
+									"\"Chords\":[{\"Keys\":[\"Mod1+x\",\"t\"],\"Action\":\"ReloadWidgets\",\"Argument\":\"\"}]}"));
+	cdb->initKeycodes(nullptr, &wrapper);
+	EXPECT_EQ(cdb->getBindings().size(), 4u);
+	ASSERT_NE(cdb->findBinding('m', Mod1Mask), nullptr);
+	EXPECT_EQ(cdb->findBinding('x', Mod1Mask), nullptr);
+	EXPECT_EQ(cdb->findBinding('h', 0), nullptr);
+	XKeyEvent event{};
+	event.keycode = 'x';
+	event.state = Mod1Mask;
+	cdb->handleKeypressEvent(&event);
+	EXPECT_TRUE(cdb->isKeyboardGrabbed());
+	event.keycode = 'q';
+	event.state = 0;
+	cdb->handleKeypressEvent(&event);
+	EXPECT_FALSE(cdb->isKeyboardGrabbed());
+	event.keycode = 'x';
+	event.state = Mod1Mask;
+	cdb->handleKeypressEvent(&event);
+	event.keycode = 't';
+	event.state = 0;
+	cdb->handleKeypressEvent(&event);
+	EXPECT_FALSE(cdb->isKeyboardGrabbed());
+	cdb->enterMode("resize");
+	EXPECT_EQ(cdb->getActiveMode(), "resize");
+	EXPECT_TRUE(cdb->isKeyboardGrabbed());
+	event.keycode = 'h';
+	cdb->handleKeypressEvent(&event);
+	event.keycode = 'l';
+	event.state = ShiftMask | LockMask;
+	cdb->handleKeypressEvent(&event);
+	EXPECT_EQ(cdb->getActiveMode(), "resize");
+	event.keycode = XK_Escape;
+	event.state = 0;
+	cdb->handleKeypressEvent(&event);
+	EXPECT_EQ(cdb->getActiveMode(), "");
+	EXPECT_FALSE(cdb->isKeyboardGrabbed());
+	cdb->enterMode("unknown");
+	EXPECT_FALSE(cdb->isKeyboardGrabbed());
+}
+TEST_F(ConfigDataBindingsTest, refreshKeycodesRegrabsOnlyChangedKeys) {
+	::testing::NiceMock<mockX11Wrapper> wrapper;
+	int remapped = '2';
+	ON_CALL(wrapper, stringToKeysym(::testing::_)).WillByDefault([](const char *key) { return static_cast<KeySym>(key[0]); });
+	ON_CALL(wrapper, keysymToKeycode(::testing::_, ::testing::_)).WillByDefault([&remapped](Display *, int keysym) {
+		return keysym == '2' ? remapped : keysym;
+	});
+	cdb->configInit(makeBindingJson("{\"Mod1\":[{\"Key\":\"1\",\"Action\":\"FocusGroup\",\"Argument\":\"1\"},"
+									"{\"Key\":\"2\",\"Action\":\"FocusGroup\",\"Argument\":\"2\"}]}"));
+	cdb->initKeycodes(nullptr, &wrapper);
+	EXPECT_CALL(wrapper, grabKey(::testing::_, ::testing::_, ::testing::_, ::testing::_, ::testing::_, ::testing::_, ::testing::_)).Times(0);
+	EXPECT_CALL(wrapper, ungrabKey(::testing::_, ::testing::_, ::testing::_, ::testing::_)).Times(0);
+	EXPECT_EQ(cdb->refreshKeycodes(nullptr, &wrapper, {1}), 0u);
+	::testing::Mock::VerifyAndClearExpectations(&wrapper);
+	remapped = '9';
+	EXPECT_CALL(wrapper, ungrabKey(::testing::_, '2', ::testing::_, 1)).Times(4);
+	EXPECT_CALL(wrapper, grabKey(::testing::_, '9', ::testing::_, 1, ::testing::_, ::testing::_, ::testing::_)).Times(4);
+	EXPECT_EQ(cdb->refreshKeycodes(nullptr, &wrapper, {1}), 1u);
+	EXPECT_EQ(cdb->findBinding('2', Mod1Mask), nullptr);
+	ASSERT_NE(cdb->findBinding('9', Mod1Mask), nullptr);
+	EXPECT_EQ(cdb->findBinding('9', Mod1Mask)->getArgs(), "2");
+	ASSERT_NE(cdb->findBinding('1', Mod1Mask), nullptr);
+}
 class ConfigDataBindingsParamTest : public ::testing::TestWithParam<Json::Value> {
 protected:
 	static std::ostringstream oss;
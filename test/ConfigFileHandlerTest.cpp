@@ -27,3 +27,76 @@
  */
 
 #include <gtest/gtest.h>
+#include "Config/ConfigFileHandler.hpp"
+#include "Config/ConfigHandler.hpp"
+#include "Logger.hpp"
+#include <sstream>
+#include <fstream>
+#include <cstdlib>
+#include <unistd.h>
+
+class ConfigFileHandlerTest : public ::testing::Test {
+protected:
+	static std::ostringstream oss;
+	std::string dir;
+	std::string path;
+	static void SetUpTestSuite() {
+		Logger::Create(ConfigFileHandlerTest::oss, L_INFO);
+	}
+	void SetUp() override {
+		char tmpl[] = "/tmp/yggdrasil-configXXXXXX";
+		dir = mkdtemp(tmpl);
+		path = dir + "/config.json";
+		write(R"({"Groups":[{"Name":"1","Layout":"Tree","Inactive_Color":"#FF0000","Active_Color":"#00FF00","Border_Size":1,"Gap":10}],)"
+			  R"("Bars":[{"Bar_Size":30,"Font":"Arial","Font_Size":12,"Font_Color":"#000000","Background_Color":"#FFFFFF",)"
+			  R"("Border_Size":2,"Border_Color":"#000000","Position":"top","Widgets":[{"Type":"Clock","Plugin":"libclockWidget.so",)"
+			  R"("Font":"DejaVu Sans","Font_Size":10,"Border_Size":1,"Border_Color":"#000000","Position":10,"Size":150,)"
+			  R"("Color":"#000000","Background_Color":"#FFFFFF","Arguments":""}]}],)"
+			  R"("Bindings":{"Mod1":[{"Key":"Q","Action":"Quit","Argument":""}]}})");
+	}
+	void TearDown() override {
+		unlink(path.c_str());
+		unlink((dir + "/other.json").c_str());
+		rmdir(dir.c_str());
+	}
+	void write(const std::string &content, const std::string &file = "") const {
+		std::ofstream out(file.empty() ? path : file, std::ios::trunc);
+		out << content;
+	}
+	static void TearDownTestSuite() {
+		Logger::Destroy();
+	}
+};
+std::ostringstream ConfigFileHandlerTest::oss = std::ostringstream();
+
+TEST_F(ConfigFileHandlerTest, watchReportsConfigWrites) {
+	ConfigFileHandler handler(path);
+	ASSERT_GE(handler.watch(), 0);
+	EXPECT_FALSE(handler.fileChanged());
+	write("{}", dir + "/other.json");
+	EXPECT_FALSE(handler.fileChanged());
+	write("{}");
+	EXPECT_TRUE(handler.fileChanged());
+	EXPECT_FALSE(handler.fileChanged());
+}
+
+TEST_F(ConfigFileHandlerTest, reloadReplacesOnlyChangedSections) {
+	ConfigHandler::Create(path);
+	ConfigHandler &config = ConfigHandler::GetInstance();
+	config.configInit();
+	Json::Value root = config.getRoot();
+	root["Bindings"]["Mod1"][0]["Key"] = "W";
+	write(Json::writeString(Json::StreamWriterBuilder(), root));
+	ConfigReload reload = config.reload();
+	EXPECT_NE(reload.bindings, nullptr);
+	EXPECT_EQ(reload.groups, nullptr);
+	EXPECT_EQ(reload.bars, nullptr);
+	EXPECT_EQ(reload.previous["Bindings"]["Mod1"][0]["Key"].asString(), "Q");
+	EXPECT_EQ(config.getRoot()["Bindings"]["Mod1"][0]["Key"].asString(), "W");
+	write("{\"Groups\": [");
+	reload = config.reload();
+	EXPECT_EQ(reload.bindings, nullptr);
+	EXPECT_EQ(config.getRoot()["Bindings"]["Mod1"][0]["Key"].asString(), "W");
+	ConfigHandler::Destroy();
+}
+
@@ -0,0 +1,79 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file EventQueueTest.cpp
+ * @brief EventQueue class unit tests.
+ * @date 2026-10-19
+ *
+ */
+
+#include <gtest/gtest.h>
+#include "Ipc/EventQueue.hpp"
+#include <string>
+#include <vector>
+
+static std::vector<std::string> drain(EventQueue &queue) {
+	std::vector<std::string> events;
+	std::string payload;
+	while (queue.pop(payload))
+		events.push_back(payload);
+	return events;
+}
+
+TEST(EventQueueTest, coalescesLatestPerKey) {
+	EventQueue queue(16);
+	queue.push("focus 1", "focus", 0, true);
+	queue.push("title 7 a", "title", 7, true);
+	queue.push("new 9", "window", 9, false);
+	queue.push("focus 2", "focus", 0, true);
+	queue.push("title 7 b", "title", 7, true);
+	queue.push("title 8", "title", 8, true);
+	EXPECT_EQ(queue.size(), 4);
+	EXPECT_EQ(queue.getCoalesced(), 2);
+	EXPECT_EQ(drain(queue), (std::vector<std::string>{"new 9", "focus 2", "title 7 b", "title 8"}));
+	EXPECT_EQ(queue.getDelivered(), 4);
+	queue.push("focus 3", "focus", 0, true);
+	EXPECT_EQ(drain(queue), (std::vector<std::string>{"focus 3"}));
+	EXPECT_EQ(queue.getCoalesced(), 2);
+}
+
+TEST(EventQueueTest, dropsOldestWhenFull) {
+	EventQueue queue(3);
+	for (int i = 0; i < 5; i++)
+		queue.push("new " + std::to_string(i), "window", i, false);
+	EXPECT_EQ(queue.size(), 3);
+	EXPECT_EQ(queue.getDropped(), 2);
+	queue.push("focus", "focus", 0, true);
+	EXPECT_EQ(queue.getDropped(), 3);
+	EXPECT_EQ(drain(queue), (std::vector<std::string>{"new 3", "new 4", "focus"}));
+}
+
+TEST(EventQueueTest, coalescingKeepsMemoryBounded) {
+	EventQueue queue(4);
+	queue.push("new", "window", 1, false);
+	for (int i = 0; i < 1000; i++)
+		queue.push("focus " + std::to_string(i), "focus", 0, true);
+	EXPECT_EQ(queue.size(), 2);
+	EXPECT_EQ(queue.getCoalesced(), 999);
+	EXPECT_EQ(queue.getDropped(), 0);
+	EXPECT_EQ(drain(queue), (std::vector<std::string>{"new", "focus 999"}));
+}
@@ -27,3 +27,49 @@
  */
 
 #include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "Group.hpp"
+#include "Client.hpp"
+#include "Layouts/LayoutManager.hpp"
+#include "X11wrapper/mockX11Wrapper.hpp"
+#include "Logger.hpp"
+#include <memory>
+#include <sstream>
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+static std::shared_ptr<ConfigDataGroup> makeGroupConfig(int borderSize, int gap) {
+	Json::Value root;
+	root["Name"] = "1";
+	root["Layout"] = "MasterVertical";
+	root["Inactive_Color"] = "#FF0000";
+	root["Active_Color"] = "#00FF00";
+	root["Border_Size"] = borderSize;
+	root["Gap"] = gap;
+	auto config = std::make_shared<ConfigDataGroup>();
+	config->configInit(root);
+	return config;
+}
+
+TEST(GroupTest, borderOnlyReloadShrinksTheLayout) {
+	static std::ostringstream oss;
+	Logger::Create(oss, L_INFO);
+	auto wrapper = std::make_shared<NiceMock<mockX11Wrapper>>();
+	ON_CALL(*wrapper, displayWidth(_, _)).WillByDefault(Return(800));
+	ON_CALL(*wrapper, displayHeight(_, _)).WillByDefault(Return(600));
+	Group group(makeGroupConfig(1, 10), wrapper, nullptr, 42);
+	auto client = std::make_shared<Client>(nullptr, 42, 1000, nullptr, 0, 1, wrapper);
+	unsigned int before = 0;
+	EXPECT_CALL(*wrapper, resizeWindow(_, 1000, _, _)).WillOnce([&](Display *, Window, unsigned int width, unsigned int) {
+		before = width;
+		return 0;
+	});
+	group.getLayoutManager()->addClient(client);
+	::testing::Mock::VerifyAndClearExpectations(wrapper.get());
+	EXPECT_CALL(*wrapper, resizeWindow(_, 1000, before - 4, _)).Times(1);
+	group.applyConfig(makeGroupConfig(3, 10));
+	EXPECT_EQ(group.getBorderSize(), 3);
+	EXPECT_EQ(group.getGap(), 10);
+}
@@ -0,0 +1,108 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file IpcServerTest.cpp
+ * @brief IpcServer class unit tests.
+ * @date 2026-10-19
+ *
+ */
+
+#include <gtest/gtest.h>
+#include "Ipc/IpcServer.hpp"
+#include "Logger.hpp"
+#include <sstream>
+#include <stdexcept>
+
+class IpcServerTest : public ::testing::Test {
+protected:
+	static std::ostringstream oss;
+	static void SetUpTestSuite() {
+		Logger::Create(IpcServerTest::oss, L_INFO);
+	}
+	static Json::Value parse(const std::string &reply) {
+		Json::Value value;
+		Json::CharReaderBuilder builder;
+		std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
+		std::string errors;
+		EXPECT_TRUE(reader->parse(reply.data(), reply.data() + reply.size(), &value, &errors)) << errors;
+		return value;
+	}
+};
+std::ostringstream IpcServerTest::oss;
+
+TEST_F(IpcServerTest, frameRoundTrip) {
+	std::string buffer = IpcServer::encodeFrame(R"({"Query":"groups"})") + IpcServer::encodeFrame("{}");
+	std::string payload;
+	ASSERT_EQ(buffer.size(), 4 + 18 + 4 + 2);
+	ASSERT_TRUE(IpcServer::decodeFrame(buffer, payload));
+	EXPECT_EQ(payload, R"({"Query":"groups"})");
+	ASSERT_TRUE(IpcServer::decodeFrame(buffer, payload));
+	EXPECT_EQ(payload, "{}");
+	EXPECT_TRUE(buffer.empty());
+}
+
+TEST_F(IpcServerTest, partialFrameWaitsForMoreData) {
+	std::string frame = IpcServer::encodeFrame("{\"Query\":\"tree\"}");
+	std::string buffer = frame.substr(0, 3);
+	std::string payload;
+	EXPECT_FALSE(IpcServer::decodeFrame(buffer, payload));
+	buffer = frame.substr(0, frame.size() - 1);
+	EXPECT_FALSE(IpcServer::decodeFrame(buffer, payload));
+	buffer += frame.back();
+	EXPECT_TRUE(IpcServer::decodeFrame(buffer, payload));
+	EXPECT_EQ(payload, "{\"Query\":\"tree\"}");
+}
+
+TEST_F(IpcServerTest, oversizedFrameThrows) {
+	std::string buffer = {'\x7f', '\0', '\0', '\0'};
+	std::string payload;
+	EXPECT_THROW(IpcServer::decodeFrame(buffer, payload), std::runtime_error);
+}
+
+TEST_F(IpcServerTest, invalidRequestsAreRejected) {
+	IpcServer server("/tmp/yggdrasilwm-test.sock");
+	for (const std::string request : {"not json", "[1, 2]", R"({"Other":1})", R"({"Commands":{}})",
+									  R"({"Commands":[{"Action":"Unknown","Argument":""}]})",
+									  R"({"Commands":[{"Action":"Quit","Argument":"","Target":"window"}]})"}) {
+		Json::Value reply = parse(server.handleRequest(request));
+		EXPECT_FALSE(reply["Ok"].asBool()) << request;
+		EXPECT_FALSE(reply["Error"].asString().empty()) << request;
+	}
+}
+
+TEST_F(IpcServerTest, subscribeNeedsAConnection) {
+	IpcServer server("/tmp/yggdrasilwm-test.sock");
+	Json::Value reply = parse(server.handleRequest(R"({"Subscribe":["focus"]})"));
+	EXPECT_FALSE(reply["Ok"].asBool());
+	EXPECT_FALSE(server.wants(IPC_FOCUS));
+	reply = parse(server.handleRequest(R"({"Query":"subscribers"})"));
+	EXPECT_TRUE(reply["Ok"].asBool());
+	EXPECT_EQ(reply["Data"].size(), 0);
+}
+
+TEST_F(IpcServerTest, invalidTargetRunsNothing) {
+	IpcServer server("/tmp/yggdrasilwm-test.sock");
+	Json::Value reply = parse(server.handleRequest(
+			R"({"Commands":[{"Action":"Quit","Argument":""},{"Action":"Quit","Argument":"","Target":-1}]})"));
+	EXPECT_FALSE(reply["Ok"].asBool());
+	EXPECT_NE(reply["Error"].asString().find("invalid Target"), std::string::npos);
+}
@@ -0,0 +1,70 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file LayoutTestFixture.hpp
+ * @brief common fixture of the layout manager unit tests.
+ * @date 2026-10-19
+ *
+ */
+
+#ifndef YGGDRASILWM_LAYOUTTESTFIXTURE_HPP
+#define YGGDRASILWM_LAYOUTTESTFIXTURE_HPP
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "X11wrapper/mockX11Wrapper.hpp"
+#include "Client.hpp"
+#include <memory>
+#include <vector>
+
+/**
+ * @class LayoutTestFixture
+ * @brief holds the mocked wrapper, the layout under test and the clients created with newClient()
+ */
+template <typename Layout>
+class LayoutTestFixture : public ::testing::Test {
+protected:
+	std::shared_ptr<::testing::NiceMock<mockX11Wrapper>> x11WrapperMock;
+	std::unique_ptr<Layout> layout;
+	std::vector<std::shared_ptr<Client>> clients;
+
+	void SetUp() override {
+		x11WrapperMock = std::make_shared<::testing::NiceMock<mockX11Wrapper>>();
+	}
+/**
+ * @fn std::shared_ptr<Client> LayoutTestFixture::newClient()
+ * @brief create an unframed client with the next window id, starting at 1000
+ */
+	std::shared_ptr<Client> newClient() {
+		auto c = std::make_shared<Client>(nullptr,
+										  42,
+										  1000 + clients.size(),
+										  nullptr,
+										  0,
+										  1,
+										  x11WrapperMock);
+		clients.push_back(c);
+		return c;
+	}
+};
+
+#endif //YGGDRASILWM_LAYOUTTESTFIXTURE_HPP
@@ -0,0 +1,137 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file MasterLayoutManagerTest.cpp
+ * @brief MasterLayoutManager class unit tests.
+ * @date 2026-10-19
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "Layouts/MasterLayoutManager.hpp"
+#include "LayoutTestFixture.hpp"
+#include "Logger.hpp"
+#include <memory>
+#include <sstream>
+#include <vector>
+
+using ::testing::_;
+using ::testing::AnyNumber;
+
+class MasterLayoutManagerTest : public LayoutTestFixture<MasterLayoutManager> {
+protected:
+	static std::ostringstream oss;
+
+	static void SetUpTestSuite() {
+		std::cout << " =================================================================================== " << std::endl;
+		std::cout << " ======================== MasterLayoutManager SetUpTestSuite ======================= " << std::endl;
+		std::cout << " =================================================================================== " << std::endl;
+		Logger::Create(MasterLayoutManagerTest::oss,L_INFO);
+	}
+	void SetUp() override {
+		LayoutTestFixture::SetUp();
+		layout = std::make_unique<MasterLayoutManager>(nullptr, 42, 800, 600, 0, 0, 1, 0, 30, true);
+	}
+};
+std::ostringstream MasterLayoutManagerTest::oss;
+
+TEST_F(MasterLayoutManagerTest, firstClientsFillMaster) {
+	layout->addClient(newClient());
+	EXPECT_EQ(layout->getMasterSpace().getClientCount(), 1);
+	EXPECT_EQ(layout->getStackSpace().getClientCount(), 0);
+	EXPECT_EQ(layout->getMasterSpace().getSize().x, 799);
+	layout->addClient(newClient());
+	layout->addClient(newClient());
+	EXPECT_EQ(layout->getMasterSpace().getClientCount(), 1);
+	EXPECT_EQ(layout->getStackSpace().getClientCount(), 2);
+	EXPECT_EQ(layout->getStackSpace().getPos().x, layout->getMasterSpace().getSize().x);
+	std::vector<ClientRect> rects;
+	layout->solve(rects);
+	ASSERT_EQ(rects.size(), 3);
+	EXPECT_EQ(rects[0].client, clients[0].get());
+	EXPECT_EQ(rects[1].y, rects[2].y - static_cast<int>(layout->getStackSpace().getSize().y / 2));
+}
+
+TEST_F(MasterLayoutManagerTest, addStackClientLeavesMasterAlone) {
+	layout->addClient(newClient());
+	layout->addClient(newClient());
+	EXPECT_CALL(*x11WrapperMock, moveWindow(_, _, _, _)).Times(AnyNumber());
+	EXPECT_CALL(*x11WrapperMock, resizeWindow(_, _, _, _)).Times(AnyNumber());
+	EXPECT_CALL(*x11WrapperMock, moveWindow(_, 1000, _, _)).Times(0);
+	EXPECT_CALL(*x11WrapperMock, resizeWindow(_, 1000, _, _)).Times(0);
+	EXPECT_CALL(*x11WrapperMock, resizeWindow(_, 1001, _, _)).Times(1);
+	layout->addClient(newClient());
+}
+
+TEST_F(MasterLayoutManagerTest, removeMasterPromotesStack) {
+	for (int i = 0; i < 3; i++)
+		layout->addClient(newClient());
+	layout->removeClient(clients[0].get());
+	ASSERT_EQ(layout->getMasterSpace().getClientCount(), 1);
+	EXPECT_EQ(layout->getMasterSpace().getClients()[0], clients[1].get());
+	EXPECT_EQ(layout->getStackSpace().getClientCount(), 1);
+	layout->removeClient(clients[2].get());
+	EXPECT_EQ(layout->getStackSpace().getClientCount(), 0);
+	EXPECT_EQ(layout->getMasterSpace().getSize().x, 799);
+}
+
+TEST_F(MasterLayoutManagerTest, setParamsCommitsOnce) {
+	for (int i = 0; i < 4; i++)
+		layout->addClient(newClient());
+	EXPECT_CALL(*x11WrapperMock, resizeWindow(_, _, _, _)).Times(AnyNumber());
+	EXPECT_CALL(*x11WrapperMock, resizeWindow(_, 1000, _, _)).Times(1);
+	EXPECT_CALL(*x11WrapperMock, resizeWindow(_, 1001, _, _)).Times(1);
+	layout->setParams(2, 0.6);
+	EXPECT_EQ(layout->getMasterCount(), 2);
+	EXPECT_DOUBLE_EQ(layout->getRatio(), 0.6);
+	EXPECT_EQ(layout->getMasterSpace().getClientCount(), 2);
+	::testing::Mock::VerifyAndClearExpectations(x11WrapperMock.get());
+	layout->setRatio(5.0);
+	EXPECT_DOUBLE_EQ(layout->getRatio(), 0.9);
+}
+
+TEST_F(MasterLayoutManagerTest, batchCommitsOnceAtTheEnd) {
+	for (int i = 0; i < 2; i++)
+		layout->addClient(newClient());
+	EXPECT_CALL(*x11WrapperMock, resizeWindow(_, _, _, _)).Times(AnyNumber());
+	EXPECT_CALL(*x11WrapperMock, resizeWindow(_, 1000, _, _)).Times(1);
+	EXPECT_CALL(*x11WrapperMock, resizeWindow(_, 1002, _, _)).Times(1);
+	{
+		LayoutBatch batch;
+		layout->addClient(newClient());
+		layout->setRatio(0.7);
+		layout->setRatio(0.6);
+	}
+}
+
+TEST_F(MasterLayoutManagerTest, fullscreenClientsAreLeftAlone) {
+	layout->addClient(newClient());
+	clients[0]->setFullscreen(true);
+	EXPECT_CALL(*x11WrapperMock, resizeWindow(_, _, _, _)).Times(AnyNumber());
+	EXPECT_CALL(*x11WrapperMock, resizeWindow(_, 1000, _, _)).Times(0);
+	layout->addClient(newClient());
+	::testing::Mock::VerifyAndClearExpectations(x11WrapperMock.get());
+	clients[0]->setFullscreen(false);
+	EXPECT_CALL(*x11WrapperMock, resizeWindow(_, 1000, _, _)).Times(1);
+	layout->relayout();
+}
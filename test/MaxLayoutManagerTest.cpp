@@ -0,0 +1,117 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file MaxLayoutManagerTest.cpp
+ * @brief MaxLayoutManager class unit tests.
+ * @date 2026-10-19
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "Layouts/MaxLayoutManager.hpp"
+#include "LayoutTestFixture.hpp"
+#include "Group.hpp"
+#include "Logger.hpp"
+#include <memory>
+#include <sstream>
+#include <vector>
+
+using ::testing::_;
+
+class MaxLayoutManagerTest : public LayoutTestFixture<MaxLayoutManager> {
+protected:
+	static std::ostringstream oss;
+
+	static void SetUpTestSuite() {
+		std::cout << " =================================================================================== " << std::endl;
+		std::cout << " ========================= MaxLayoutManager SetUpTestSuite ========================= " << std::endl;
+		std::cout << " =================================================================================== " << std::endl;
+		Logger::Create(MaxLayoutManagerTest::oss,L_INFO);
+	}
+	void SetUp() override {
+		LayoutTestFixture::SetUp();
+		layout = std::make_unique<MaxLayoutManager>(nullptr, 42, 800, 600, 0, 0, 1, 0, 30);
+	}
+};
+std::ostringstream MaxLayoutManagerTest::oss;
+
+TEST_F(MaxLayoutManagerTest, newClientHidesPrevious) {
+	layout->addClient(newClient());
+	EXPECT_CALL(*x11WrapperMock, unmapWindow(_, 1000)).Times(1);
+	EXPECT_CALL(*x11WrapperMock, mapWindow(_, 1001)).Times(1);
+	layout->addClient(newClient());
+	EXPECT_TRUE(layout->isVisible(clients[1].get()));
+	EXPECT_FALSE(layout->isVisible(clients[0].get()));
+	std::vector<ClientRect> rects;
+	layout->solve(rects);
+	ASSERT_EQ(rects.size(), 1);
+	EXPECT_EQ(rects[0].client, clients[1].get());
+}
+
+TEST_F(MaxLayoutManagerTest, hiddenClientsAreNotResized) {
+	for (int i = 0; i < 3; i++)
+		layout->addClient(newClient());
+	EXPECT_CALL(*x11WrapperMock, resizeWindow(_, 1000, _, _)).Times(0);
+	EXPECT_CALL(*x11WrapperMock, resizeWindow(_, 1001, _, _)).Times(0);
+	EXPECT_CALL(*x11WrapperMock, resizeWindow(_, 1002, _, _)).Times(1);
+	layout->reSize(Point(600, 400), Point(0, 0));
+	::testing::Mock::VerifyAndClearExpectations(x11WrapperMock.get());
+	EXPECT_CALL(*x11WrapperMock, resizeWindow(_, 1000, _, _)).Times(1);
+	layout->focusClient(clients[0].get());
+}
+
+TEST_F(MaxLayoutManagerTest, removeVisibleShowsPrevious) {
+	for (int i = 0; i < 3; i++)
+		layout->addClient(newClient());
+	EXPECT_EQ(layout->nextClient(1), clients[0].get());
+	EXPECT_EQ(layout->nextClient(-1), clients[1].get());
+	EXPECT_CALL(*x11WrapperMock, mapWindow(_, 1001)).Times(1);
+	layout->removeClient(clients[2].get());
+	EXPECT_EQ(layout->getVisibleClient(), clients[1].get());
+	layout->removeClient(clients[0].get());
+	EXPECT_EQ(layout->getVisibleClient(), clients[1].get());
+	layout->removeClient(clients[1].get());
+	EXPECT_EQ(layout->getVisibleClient(), nullptr);
+	EXPECT_EQ(layout->nextClient(1), nullptr);
+}
+TEST_F(MaxLayoutManagerTest, removeFromHiddenGroupDoesNotMap) {
+	Json::Value root;
+	root["Name"] = "2";
+	root["Layout"] = "Max";
+	root["Inactive_Color"] = "#FF0000";
+	root["Active_Color"] = "#00FF00";
+	root["Border_Size"] = 1;
+	root["Gap"] = 0;
+	auto config = std::make_shared<ConfigDataGroup>();
+	config->configInit(root);
+	auto group = std::make_shared<Group>(config, x11WrapperMock, nullptr, 42);
+	ASSERT_FALSE(group->isActive());
+	auto first = std::make_shared<Client>(nullptr, 42, 1000, group, 0, 1, x11WrapperMock);
+	auto second = std::make_shared<Client>(nullptr, 42, 1001, group, 0, 1, x11WrapperMock);
+	EXPECT_CALL(*x11WrapperMock, mapWindow(_, _)).Times(0);
+	layout->addClient(first);
+	layout->addClient(second);
+	layout->removeClient(second.get());
+	EXPECT_EQ(layout->getVisibleClient(), first.get());
+	EXPECT_TRUE(layout->isVisible(first.get()));
+}
@@ -0,0 +1,100 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file OutputsTest.cpp
+ * @brief Outputs class unit tests.
+ * @date 2026-10-19
+ *
+ */
+
+#include <gtest/gtest.h>
+#include "Outputs.hpp"
+
+static OutputGeometry makeOutput(const std::string &name, int x, int y, unsigned int width, unsigned int height) {
+	OutputGeometry output;
+	output.name = name;
+	output.x = x;
+	output.y = y;
+	output.width = width;
+	output.height = height;
+	return output;
+}
+
+TEST(OutputsTest, unchangedOutputsKeepTheirGroup) {
+	Outputs outputs;
+	std::vector<size_t> released;
+	auto changed = outputs.update({makeOutput("DP-1", 0, 0, 1920, 1080), makeOutput("HDMI-1", 1920, 0, 1280, 1024)}, released);
+	EXPECT_EQ(changed, (std::vector<size_t>{0, 1}));
+	outputs.setGroup(0, 0);
+	outputs.setGroup(1, 3);
+	outputs.setFocused(1);
+	changed = outputs.update({makeOutput("DP-1", 0, 0, 1920, 1080), makeOutput("HDMI-1", 1920, 0, 1920, 1080)}, released);
+	EXPECT_EQ(changed, (std::vector<size_t>{1}));
+	EXPECT_TRUE(released.empty());
+	EXPECT_EQ(outputs.getGroup(1), 3u);
+	EXPECT_EQ(outputs.find(3), 1u);
+	EXPECT_EQ(outputs.getFocused(), 1u);
+}
+
+TEST(OutputsTest, removedOutputsReleaseTheirGroup) {
+	Outputs outputs;
+	std::vector<size_t> released;
+	outputs.update({makeOutput("eDP-1", 0, 0, 1920, 1080), makeOutput("DP-1", 1920, 0, 2560, 1440)}, released);
+	outputs.setGroup(0, 0);
+	outputs.setGroup(1, 1);
+	outputs.setFocused(1);
+	auto changed = outputs.update({makeOutput("eDP-1", 0, 0, 1920, 1080)}, released);
+	EXPECT_TRUE(changed.empty());
+	EXPECT_EQ(released, (std::vector<size_t>{1}));
+	EXPECT_EQ(outputs.size(), 1u);
+	EXPECT_EQ(outputs.getFocused(), 0u);
+	EXPECT_EQ(outputs.find(1), Outputs::none);
+	released.clear();
+	changed = outputs.update({makeOutput("DP-1", 0, 0, 2560, 1440), makeOutput("eDP-1", 2560, 0, 1920, 1080)}, released);
+	EXPECT_EQ(changed, (std::vector<size_t>{0, 1}));
+	EXPECT_EQ(outputs.getGroup(0), Outputs::none);
+	EXPECT_EQ(outputs.getGroup(1), 0u);
+	EXPECT_EQ(outputs.getFocused(), 1u);
+}
+
+TEST(OutputsTest, areaIsClippedToTheWorkArea) {
+	Outputs outputs;
+	std::vector<size_t> released;
+	outputs.update({makeOutput("left", 0, 0, 1920, 1080), makeOutput("right", 1920, 0, 1280, 1024)}, released);
+	WorkArea work(3200, 1080);
+	Strut bar;
+	bar.top = 30;
+	bar.bottom = 40;
+	work.setBase(bar);
+	EXPECT_TRUE(outputs.setArea(0, work));
+	EXPECT_TRUE(outputs.setArea(1, work));
+	EXPECT_EQ(outputs.getArea(0).y, 30);
+	EXPECT_EQ(outputs.getArea(0).height, 1080u - 70);
+	EXPECT_EQ(outputs.getArea(1).x, 1920);
+	EXPECT_EQ(outputs.getArea(1).y, 30);
+	EXPECT_EQ(outputs.getArea(1).height, 1024u - 30);
+	EXPECT_FALSE(outputs.setArea(0, work));
+	bar.bottom = 0;
+	work.setBase(bar);
+	EXPECT_TRUE(outputs.setArea(0, work));
+	EXPECT_FALSE(outputs.setArea(1, work));
+}
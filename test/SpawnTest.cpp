@@ -27,3 +27,55 @@
  */
 
 #include <gtest/gtest.h>
+#include "Commands/Spawn.hpp"
+#include "Logger.hpp"
+#include <poll.h>
+#include <unistd.h>
+#include <sstream>
+
+class SpawnTest : public ::testing::Test {
+protected:
+	static std::ostringstream oss;
+	static int childFd;
+	static void SetUpTestSuite() {
+		Logger::Create(SpawnTest::oss, L_INFO);
+		childFd = Spawn::openChildSignalFd();
+	}
+	static void TearDownTestSuite() {
+		if (childFd >= 0)
+			close(childFd);
+	}
+	void waitChildren() {
+		for (int i = 0; i < 50 && Spawn::getChildCount() > 0; i++) {
+			pollfd fd = {childFd, POLLIN, 0};
+			poll(&fd, 1, 100);
+			Spawn::reapChildren(childFd);
+		}
+	}
+};
+std::ostringstream SpawnTest::oss;
+int SpawnTest::childFd = -1;
+
+TEST_F(SpawnTest, prepareSplitsArguments) {
+	Spawn spawn;
+	spawn.prepare("sh -c 'echo a  b' \"x y\"   z");
+	std::vector<std::string> expected = {"sh", "-c", "echo a  b", "x y", "z"};
+	EXPECT_EQ(spawn.getArgv(), expected);
+}
+
+TEST_F(SpawnTest, childIsReaped) {
+	ASSERT_GE(childFd, 0);
+	Spawn spawn;
+	spawn.prepare("true");
+	spawn.execute(CommandContext());
+	EXPECT_EQ(Spawn::getChildCount(), 1);
+	waitChildren();
+	EXPECT_EQ(Spawn::getChildCount(), 0);
+}
+
+TEST_F(SpawnTest, launchFailureIsLogged) {
+	Spawn spawn;
+	spawn.prepare("/nonexistent/yggdrasil-command");
+	EXPECT_NO_THROW(spawn.execute(CommandContext()));
+	EXPECT_EQ(Spawn::getChildCount(), 0);
+}
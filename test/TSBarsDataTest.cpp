@@ -0,0 +1,112 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file TSBarsDataTest.cpp
+ * @brief TSBarsData and SystemSampler tests
+ * @date 2026-10-19
+ *
+ */
+
+#include <gtest/gtest.h>
+#include "Bars/TSBarsData.hpp"
+#include "Bars/SystemSampler.hpp"
+#include <memory>
+
+struct TestStruct {
+	int a;
+	int b;
+};
+
+TEST(TSBarsDataTest, getChannelIsStable) {
+	TSBarsData data;
+	BarsChannel groups = data.getChannel("Groups");
+	BarsChannel active = data.getChannel("ActiveGroup");
+	EXPECT_NE(groups, active);
+	EXPECT_EQ(groups, data.getChannel("Groups"));
+}
+
+TEST(TSBarsDataTest, collectReturnsModifiedChannelsOnce) {
+	TSBarsData data;
+	BarsChannel groups = data.getChannel("Groups");
+	BarsChannel active = data.getChannel("ActiveGroup");
+	std::vector<BarsDataValue> snapshot;
+	std::vector<BarsChannel> updated;
+	data.publishStringList(groups, {"1", "2", "3"});
+	data.publishInt(active, 2);
+	data.publishInt(active, 1);
+	data.collect(snapshot, updated);
+	ASSERT_EQ(updated.size(), 2);
+	ASSERT_EQ(snapshot.size(), 2);
+	EXPECT_EQ(snapshot[groups].type, BD_STRING_LIST);
+	EXPECT_EQ(snapshot[groups].list.size(), 3);
+	EXPECT_EQ(snapshot[active].type, BD_INT);
+	EXPECT_EQ(snapshot[active].integer, 1);
+	data.collect(snapshot, updated);
+	EXPECT_TRUE(updated.empty());
+}
+
+TEST(TSBarsDataTest, unchangedValueIsNotPublished) {
+	TSBarsData data;
+	BarsChannel active = data.getChannel("ActiveGroup");
+	std::vector<BarsDataValue> snapshot;
+	std::vector<BarsChannel> updated;
+	data.publishInt(active, 3);
+	data.collect(snapshot, updated);
+	EXPECT_TRUE(data.wait());
+	data.publishInt(active, 3);
+	data.collect(snapshot, updated);
+	EXPECT_TRUE(updated.empty());
+	EXPECT_FALSE(data.dataChanged);
+}
+
+TEST(TSBarsDataTest, publishStruct) {
+	TSBarsData data;
+	BarsChannel channel = data.getChannel("Struct");
+	std::vector<BarsDataValue> snapshot;
+	std::vector<BarsChannel> updated;
+	data.publishStruct(channel, TestStruct{4, 2});
+	data.collect(snapshot, updated);
+	ASSERT_EQ(updated.size(), 1);
+	TestStruct result = snapshot[channel].asStruct<TestStruct>();
+	EXPECT_EQ(result.a, 4);
+	EXPECT_EQ(result.b, 2);
+}
+
+TEST(SystemSamplerTest, publishesSubscribedChannels) {
+	auto data = std::make_shared<TSBarsData>();
+	BarsChannel mem = data->getChannel("MemUsage");
+	BarsChannel load = data->getChannel("LoadAvg");
+	BarsChannel cpu = data->getChannel("CpuUsage");
+	BarsChannel rx = data->getChannel("NetRx");
+	SystemSampler sampler;
+	ASSERT_TRUE(sampler.init(data, [&](BarsChannel c) { return c == mem || c == load || c == cpu; }));
+	sampler.sample();
+	sampler.sample();
+	std::vector<BarsDataValue> snapshot;
+	std::vector<BarsChannel> updated;
+	data->collect(snapshot, updated);
+	EXPECT_EQ(snapshot[mem].type, BD_INT);
+	EXPECT_GE(snapshot[mem].integer, 0);
+	EXPECT_LE(snapshot[mem].integer, 100);
+	EXPECT_EQ(snapshot[load].type, BD_INT);
+	EXPECT_EQ(snapshot[rx].type, BD_NONE);
+}
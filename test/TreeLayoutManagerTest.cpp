@@ -27,3 +27,191 @@
  */
 
 #include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "Layouts/TreeLayoutManager.hpp"
+#include "LayoutTestFixture.hpp"
+#include "Logger.hpp"
+#include <memory>
+#include <sstream>
+#include <vector>
+#include <algorithm>
+
+using ::testing::_;
+
+class TreeLayoutManagerTest : public LayoutTestFixture<TreeLayoutManager> {
+protected:
+	static std::ostringstream oss;
+
+	static void SetUpTestSuite() {
+		std::cout << " =================================================================================== " << std::endl;
+		std::cout << " ========================= TreeLayoutManager SetUpTestSuite ======================== " << std::endl;
+		std::cout << " =================================================================================== " << std::endl;
+		Logger::Create(TreeLayoutManagerTest::oss,L_INFO);
+	}
+	void SetUp() override {
+		LayoutTestFixture::SetUp();
+		layout = std::make_unique<TreeLayoutManager>(nullptr, 42, 800, 600, 0, 0, 1, 0, 30);
+	}
+};
+std::ostringstream TreeLayoutManagerTest::oss;
+
+/**
+ * @brief check the leaf counts and parent links of the subtree, return its depth
+ */
+static int checkSubtree(const TreeLayoutManager &layout, SpaceIndex index, int &leaves) {
+	const BinarySpace &space = layout.getSpace(index);
+	if (space.getLeft() == NO_SPACE) {
+		EXPECT_EQ(space.getRight(), NO_SPACE);
+		EXPECT_EQ(space.getSubspaceCount(), 1);
+		leaves = 1;
+		return 1;
+	}
+	EXPECT_NE(space.getRight(), NO_SPACE);
+	EXPECT_EQ(space.getClient(), NO_CLIENT);
+	EXPECT_EQ(layout.getSpace(space.getLeft()).getParent(), index);
+	EXPECT_EQ(layout.getSpace(space.getRight()).getParent(), index);
+	int leftLeaves = 0;
+	int rightLeaves = 0;
+	int depth = std::max(checkSubtree(layout, space.getLeft(), leftLeaves),
+						 checkSubtree(layout, space.getRight(), rightLeaves));
+	leaves = leftLeaves + rightLeaves;
+	EXPECT_EQ(space.getSubspaceCount(), leaves);
+	return depth + 1;
+}
+
+TEST_F(TreeLayoutManagerTest, findSpaceUsesIndex) {
+	for (int i = 0; i < 8; i++)
+		layout->addClient(newClient());
+	for (auto &c : clients) {
+		SpaceIndex space = layout->findSpace(c.get());
+		ASSERT_NE(space, NO_SPACE);
+		EXPECT_EQ(layout->getClient(layout->getSpace(space).getClient()), c);
+	}
+	auto stranger = std::make_shared<Client>(nullptr, 42, 1, nullptr, 0, 1, x11WrapperMock);
+	EXPECT_EQ(layout->findSpace(stranger.get()), NO_SPACE);
+}
+
+TEST_F(TreeLayoutManagerTest, removeClientUpdatesIndex) {
+	for (int i = 0; i < 4; i++)
+		layout->addClient(newClient());
+	layout->removeClient(clients[1].get());
+	EXPECT_EQ(layout->findSpace(clients[1].get()), NO_SPACE);
+	for (size_t i = 0; i < clients.size(); i++) {
+		if (i == 1)
+			continue;
+		SpaceIndex space = layout->findSpace(clients[i].get());
+		ASSERT_NE(space, NO_SPACE);
+		EXPECT_EQ(layout->getClient(layout->getSpace(space).getClient()), clients[i]);
+	}
+}
+
+TEST_F(TreeLayoutManagerTest, freedSpacesAreReused) {
+	layout->addClient(newClient());
+	layout->addClient(newClient());
+	EXPECT_EQ(layout->getPoolSize(), 3);
+	for (int i = 0; i < 10; i++) {
+		layout->removeClient(clients.back().get());
+		clients.pop_back();
+		layout->addClient(newClient());
+	}
+	EXPECT_EQ(layout->getPoolSize(), 3);
+	const BinarySpace &root = layout->getSpace(layout->getRootSpace());
+	ASSERT_NE(root.getLeft(), NO_SPACE);
+	ASSERT_NE(root.getRight(), NO_SPACE);
+	EXPECT_EQ(layout->getSpace(root.getLeft()).getParent(), layout->getRootSpace());
+	EXPECT_TRUE(root.isSplitAlongX());
+}
+
+TEST_F(TreeLayoutManagerTest, removePromotesSiblingSubtree) {
+	for (int i = 0; i < 4; i++)
+		layout->addClient(newClient());
+	// root split in two subtrees of two leaves, removing a leaf promotes its sibling leaf
+	SpaceIndex space = layout->findSpace(clients[0].get());
+	SpaceIndex parent = layout->getSpace(space).getParent();
+	layout->removeClient(clients[0].get());
+	int leaves = 0;
+	checkSubtree(*layout, layout->getRootSpace(), leaves);
+	EXPECT_EQ(leaves, 3);
+	// the remaining leaves of the other subtree are promoted with their split
+	const BinarySpace &root = layout->getSpace(layout->getRootSpace());
+	SpaceIndex other = root.getLeft() == parent ? root.getRight() : root.getLeft();
+	SpaceIndex otherClientSpace = layout->getSpace(other).getLeft();
+	auto moved = layout->getClient(layout->getSpace(otherClientSpace).getClient());
+	ASSERT_NE(moved, nullptr);
+	layout->removeClient(moved.get());
+	leaves = 0;
+	checkSubtree(*layout, layout->getRootSpace(), leaves);
+	EXPECT_EQ(leaves, 2);
+	for (auto &c : clients) {
+		if (c == clients[0] || c == moved)
+			continue;
+		EXPECT_NE(layout->findSpace(c.get()), NO_SPACE);
+	}
+}
+
+TEST_F(TreeLayoutManagerTest, churnKeepsTreeBalanced) {
+	std::vector<std::shared_ptr<Client>> live;
+	for (int i = 0; i < 64; i++) {
+		live.push_back(newClient());
+		layout->addClient(live.back());
+	}
+	unsigned int seed = 42;
+	for (int i = 0; i < 2000; i++) {
+		seed = seed * 1103515245 + 12345;
+		size_t victim = (seed >> 16) % live.size();
+		layout->removeClient(live[victim].get());
+		live.erase(live.begin() + victim);
+		live.push_back(newClient());
+		layout->addClient(live.back());
+	}
+	int leaves = 0;
+	int depth = checkSubtree(*layout, layout->getRootSpace(), leaves);
+	EXPECT_EQ(leaves, 64);
+	EXPECT_LE(depth, 9);
+	EXPECT_LE(layout->getPoolSize(), 2 * 64);
+	for (auto &c : live)
+		EXPECT_NE(layout->findSpace(c.get()), NO_SPACE);
+}
+
+TEST_F(TreeLayoutManagerTest, solveCoversRootSpace) {
+	for (int i = 0; i < 5; i++)
+		layout->addClient(newClient());
+	std::vector<ClientRect> rects;
+	layout->solve(rects);
+	ASSERT_EQ(rects.size(), 5);
+	unsigned long area = 0;
+	for (auto &r : rects) {
+		SpaceIndex space = layout->findSpace(r.client);
+		ASSERT_NE(space, NO_SPACE);
+		const BinarySpace &s = layout->getSpace(space);
+		area += static_cast<unsigned long>(s.getSize().x) * s.getSize().y;
+	}
+	const BinarySpace &root = layout->getSpace(layout->getRootSpace());
+	EXPECT_EQ(area, static_cast<unsigned long>(root.getSize().x) * root.getSize().y);
+}
+
+TEST_F(TreeLayoutManagerTest, commitOnlySendsChanges) {
+	for (int i = 0; i < 4; i++)
+		layout->addClient(newClient());
+	std::vector<ClientRect> rects;
+	layout->solve(rects);
+	EXPECT_CALL(*x11WrapperMock, moveWindow(_, _, _, _)).Times(0);
+	EXPECT_CALL(*x11WrapperMock, resizeWindow(_, _, _, _)).Times(0);
+	layout->commit(rects);
+	::testing::Mock::VerifyAndClearExpectations(x11WrapperMock.get());
+	rects[0].width -= 10;
+	EXPECT_CALL(*x11WrapperMock, moveWindow(_, _, _, _)).Times(0);
+	EXPECT_CALL(*x11WrapperMock, resizeWindow(_, _, _, _)).Times(1);
+	layout->commit(rects);
+}
+
+TEST_F(TreeLayoutManagerTest, moveToSameSizeOutputMovesClients) {
+	layout->updateGeometry(800, 600, 0, 0);
+	for (int i = 0; i < 2; i++)
+		layout->addClient(newClient());
+	EXPECT_CALL(*x11WrapperMock, resizeWindow(_, _, _, _)).Times(0);
+	EXPECT_CALL(*x11WrapperMock, moveWindow(_, 1000, ::testing::Ge(800), _)).Times(1);
+	EXPECT_CALL(*x11WrapperMock, moveWindow(_, 1001, ::testing::Ge(800), _)).Times(1);
+	layout->updateGeometry(800, 600, 800, 0);
+	EXPECT_EQ(layout->getSpace(layout->getRootSpace()).getPos().x, 800);
+}
@@ -0,0 +1,75 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file WorkAreaTest.cpp
+ * @brief WorkArea class unit tests.
+ * @date 2026-10-19
+ *
+ */
+
+#include <gtest/gtest.h>
+#include "WorkArea.hpp"
+
+static Strut makeStrut(unsigned long left, unsigned long right, unsigned long top, unsigned long bottom) {
+	Strut strut;
+	strut.left = left;
+	strut.right = right;
+	strut.top = top;
+	strut.bottom = bottom;
+	return strut;
+}
+
+TEST(WorkAreaTest, biggestStrutPerEdgeIsReserved) {
+	WorkArea area(1920, 1080);
+	EXPECT_TRUE(area.setBase(makeStrut(0, 0, 30, 0)));
+	EXPECT_FALSE(area.setBase(makeStrut(0, 0, 30, 0)));
+	EXPECT_FALSE(area.setStrut(10, makeStrut(0, 0, 20, 0)));
+	EXPECT_TRUE(area.isDock(10));
+	EXPECT_TRUE(area.setStrut(11, makeStrut(48, 0, 0, 24)));
+	EXPECT_EQ(area.getX(), 48);
+	EXPECT_EQ(area.getY(), 30);
+	EXPECT_EQ(area.getWidth(), 1920u - 48);
+	EXPECT_EQ(area.getHeight(), 1080u - 30 - 24);
+	EXPECT_FALSE(area.setStrut(11, makeStrut(48, 0, 0, 24)));
+	EXPECT_TRUE(area.setStrut(10, makeStrut(0, 0, 40, 0)));
+	EXPECT_EQ(area.getY(), 40);
+}
+
+TEST(WorkAreaTest, removingADockReleasesItsSpace) {
+	WorkArea area(800, 600);
+	area.setBase(makeStrut(0, 0, 30, 0));
+	area.setStrut(10, makeStrut(0, 50, 0, 0));
+	EXPECT_TRUE(area.removeStrut(10));
+	EXPECT_FALSE(area.isDock(10));
+	EXPECT_FALSE(area.removeStrut(10));
+	EXPECT_EQ(area.getWidth(), 800u);
+	EXPECT_EQ(area.getHeight(), 570u);
+}
+
+TEST(WorkAreaTest, strutsAreClampedToHalfTheScreen) {
+	WorkArea area(800, 600);
+	area.setStrut(10, makeStrut(5000, 0, 0, 0));
+	EXPECT_EQ(area.getX(), 400);
+	EXPECT_EQ(area.getWidth(), 400u);
+	EXPECT_TRUE(area.setScreenSize(1000, 600));
+	EXPECT_EQ(area.getX(), 500);
+}
@@ -0,0 +1,179 @@
+/**
+ * Yb  dP              8                w 8 Yb        dP 8b   d8
+ *  YbdP  .d88 .d88 .d88 8d8b .d88 d88b w 8  Yb  db  dP  8YbmdP8
+ *   YP   8  8 8  8 8  8 8P   8  8 `Yb. 8 8   YbdPYbdP   8  "  8
+ *   88   `Y88 `Y88 `Y88 8    `Y88 Y88P 8 8    YP  YP    8     8
+ *        wwdP wwdP
+ * Yggdrasil Window Manager
+ * https://github.com/corecaps/YggdrasilWM
+ * Copyright (C) 2024 jgarcia <jgarcia@student.42.fr> <corecaps@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of  MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ * @file yggdrasilctl.cpp
+ * @brief command line client of the YggdrasilWM IPC socket.
+ * @date 2026-10-19
+ * usage:
+ *   yggdrasilctl [-s socket] query groups|clients|tree|subscribers
+ *   yggdrasilctl [-s socket] subscribe window|focus|title|group|layout...
+ *   yggdrasilctl [-s socket] Action [Argument...] [, Action [Argument...]]...
+ * the commands separated by "," are sent in one request and applied with
+ * one relayout. The reply is printed as JSON, the exit status is 0 if it is Ok.
+ * subscribe prints one event per line until the Window Manager exits.
+ */
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+static std::string socketPath() {
+	const char *path = std::getenv("YGGDRASIL_SOCKET");
+	if (path != nullptr && path[0] != '\0')
+		return path;
+	const char *display = std::getenv("DISPLAY");
+	std::string name;
+	for (const char *c = display ? display : ""; *c; c++) {
+		if (isalnum(static_cast<unsigned char>(*c)) || *c == '.')
+			name.push_back(*c);
+	}
+	const char *runtime = std::getenv("XDG_RUNTIME_DIR");
+	if (runtime != nullptr && runtime[0] != '\0')
+		return std::string(runtime) + "/yggdrasilwm-" + name + ".sock";
+	return "/tmp/yggdrasilwm-" + std::to_string(getuid()) + "-" + name + ".sock";
+}
+
+static std::string quote(const std::string &s) {
+	std::string out = "\"";
+	for (char c : s) {
+		if (c == '"' || c == '\\') {
+			out.push_back('\\');
+			out.push_back(c);
+		} else if (static_cast<unsigned char>(c) < 0x20) {
+			char buffer[8];
+			snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+			out += buffer;
+		} else {
+			out.push_back(c);
+		}
+	}
+	return out + "\"";
+}
+
+static std::string buildRequest(const std::vector<std::string> &args) {
+	if (args.size() == 2 && args[0] == "query")
+		return "{\"Query\":" + quote(args[1]) + "}";
+	if (args[0] == "subscribe") {
+		std::string request = "{\"Subscribe\":[";
+		for (size_t i = 1; i < args.size(); i++)
+			request += (i > 1 ? "," : "") + quote(args[i]);
+		return request + "]}";
+	}
+	std::string request = "{\"Commands\":[";
+	size_t i = 0;
+	bool first = true;
+	while (i < args.size()) {
+		std::string action = args[i++];
+		std::string argument;
+		while (i < args.size() && args[i] != ",") {
+			if (!argument.empty())
+				argument.push_back(' ');
+			argument += args[i++];
+		}
+		i++;
+		if (!first)
+			request.push_back(',');
+		first = false;
+		request += "{\"Action\":" + quote(action) + ",\"Argument\":" + quote(argument) + "}";
+	}
+	return request + "]}";
+}
+
+static bool writeAll(int fd, const std::string &data) {
+	size_t done = 0;
+	while (done < data.size()) {
+		ssize_t n = write(fd, data.data() + done, data.size() - done);
+		if (n <= 0)
+			return false;
+		done += static_cast<size_t>(n);
+	}
+	return true;
+}
+
+static bool readAll(int fd, char *data, size_t size) {
+	size_t done = 0;
+	while (done < size) {
+		ssize_t n = read(fd, data + done, size - done);
+		if (n <= 0)
+			return false;
+		done += static_cast<size_t>(n);
+	}
+	return true;
+}
+
+static bool readFrame(int fd, std::string &payload) {
+	unsigned char header[4];
+	if (!readAll(fd, reinterpret_cast<char *>(header), 4))
+		return false;
+	uint32_t length = (uint32_t(header[0]) << 24) | (uint32_t(header[1]) << 16) | (uint32_t(header[2]) << 8) | header[3];
+	payload.assign(length, '\0');
+	return length == 0 || readAll(fd, &payload[0], length);
+}
+
+int main(int argc, char **argv) {
+	std::string path;
+	std::vector<std::string> args;
+	for (int i = 1; i < argc; i++) {
+		if (std::strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+			path = argv[++i];
+		else
+			args.emplace_back(argv[i]);
+	}
+	if (args.empty()) {
+		std::cerr << "usage: yggdrasilctl [-s socket] query groups|clients|tree|subscribers\n"
+				  << "       yggdrasilctl [-s socket] subscribe window|focus|title|group|layout...\n"
+				  << "       yggdrasilctl [-s socket] Action [Argument...] [, Action [Argument...]]...\n";
+		return 2;
+	}
+	if (path.empty())
+		path = socketPath();
+	int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	sockaddr_un addr{};
+	addr.sun_family = AF_UNIX;
+	strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+	if (fd < 0 || connect(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) < 0) {
+		std::cerr << "yggdrasilctl: cannot connect to " << path << ": " << strerror(errno) << "\n";
+		return 1;
+	}
+	std::string payload = buildRequest(args);
+	auto length = static_cast<uint32_t>(payload.size());
+	std::string frame = {static_cast<char>(length >> 24), static_cast<char>((length >> 16) & 0xff),
+						 static_cast<char>((length >> 8) & 0xff), static_cast<char>(length & 0xff)};
+	std::string reply;
+	if (!writeAll(fd, frame + payload) || !readFrame(fd, reply)) {
+		std::cerr << "yggdrasilctl: connection closed\n";
+		close(fd);
+		return 1;
+	}
+	std::cout << reply << std::endl;
+	bool ok = reply.find("\"Ok\":true") != std::string::npos;
+	while (ok && args[0] == "subscribe" && readFrame(fd, reply))
+		std::cout << reply << std::endl;
+	close(fd);
+	return ok ? 0 : 1;
+}